@@ -0,0 +1,50 @@
+#include "benchmark.h"
+
+#include "std23/batch.h"
+#include "std23/function_ref.h"
+
+#include <span>
+#include <vector>
+
+// Projecting N integers through a callback: one function_ref call per
+// element, against one call per span to a function_ref bound to
+// nontype<batch<f>>, which loops over the span with f inlined.
+
+constexpr int project(int x) noexcept
+{
+    return x * 3 + 1;
+}
+
+template<std::size_t N> void per_element(bench::state &state)
+{
+    std::vector<int> xs(N, 1), ys(N);
+    std23::function_ref<int(int)> fn = std23::nontype<project>;
+
+    for (auto _ : state)
+    {
+        bench::do_not_optimize(fn);
+        for (std::size_t i = 0; i != N; ++i)
+            ys[i] = fn(xs[i]);
+        bench::do_not_optimize(ys);
+    }
+}
+
+template<std::size_t N> void batched(bench::state &state)
+{
+    std::vector<int> xs(N, 1), ys(N);
+    std23::function_ref<void(std::span<int const>, std::span<int>)> fn =
+        std23::nontype<std23::batch<project>>;
+
+    for (auto _ : state)
+    {
+        bench::do_not_optimize(fn);
+        fn(xs, ys);
+        bench::do_not_optimize(ys);
+    }
+}
+
+BENCHMARK(per_element<16>);
+BENCHMARK(batched<16>);
+
+BENCHMARK(per_element<1024>);
+BENCHMARK(batched<1024>);
@@ -0,0 +1,203 @@
+#include "common_callables.h"
+
+#include "std23/copyable_function.h"
+#include "std23/function.h"
+#include "std23/function_ref.h"
+#include "std23/inplace_move_only_function.h"
+#include "std23/move_only_function.h"
+
+#include <array>
+#include <functional>
+
+// Cost of calling through each wrapper, compared to calling a function
+// pointer or a virtual function.  int arguments are passed by value while
+// std::string arguments are forwarded as rvalue references (see _param_t).
+
+template<class S> using function = std23::function<S>;
+template<class S> using copyable_function = std23::copyable_function<S>;
+template<class S> using function_ref = std23::function_ref<S>;
+template<class S> using move_only_function = std23::move_only_function<S>;
+template<class S>
+using inplace_move_only_function = std23::inplace_move_only_function<S>;
+template<class S> using std_function = std::function<S>;
+
+using std23::nontype;
+
+// Reloading the wrapper in each iteration keeps the compiler from seeing
+// through it to the target
+template<class T, class Fn> void call_loop(bench::state &state, Fn &fn)
+{
+    for (auto _ : state)
+    {
+        bench::do_not_optimize(fn);
+        bench::do_not_optimize(fn(make_argument<T>()));
+    }
+}
+
+template<class T> void function_pointer(bench::state &state)
+{
+    auto fp = &work<T>;
+    call_loop<T>(state, fp);
+}
+
+template<class T> void virtual_call(bench::state &state)
+{
+    auto cb = make_callback<T>();
+    call_loop<T>(state, *cb);
+}
+
+template<template<class> class W, class T>
+void free_function(bench::state &state)
+{
+    W<int(T)> fn = &work<T>;
+    call_loop<T>(state, fn);
+}
+
+template<template<class> class W, class T>
+void unbound_nontype(bench::state &state)
+{
+    W<int(T)> fn = nontype<&work<T>>;
+    call_loop<T>(state, fn);
+}
+
+template<template<class> class W, class T>
+void bound_member(bench::state &state)
+{
+    worker obj;
+    if constexpr (std::is_constructible_v<W<int(T)>,
+                                          std23::nontype_t<&worker::work<T>>,
+                                          worker &>)
+    {
+        W<int(T)> fn(nontype<&worker::work<T>>, obj);
+        call_loop<T>(state, fn);
+    }
+    else
+    {
+        W<int(T)> fn = std::bind_front(&worker::work<T>, obj);
+        call_loop<T>(state, fn);
+    }
+}
+
+// A lambda capturing N pointers, or nothing
+template<template<class> class W, class T, std::size_t N>
+void lambda(bench::state &state)
+{
+    if constexpr (N == 0)
+    {
+        W<int(T)> fn = [](T x) { return work(std::move(x)); };
+        call_loop<T>(state, fn);
+    }
+    else
+    {
+        auto f = [p = std::array<void *, N>{}](T x)
+        {
+            (void)p;
+            return work(std::move(x));
+        };
+        W<int(T)> fn = f;
+        call_loop<T>(state, fn);
+    }
+}
+
+// A function_ref bound to another wrapper holding a lambda
+template<template<class> class W, class T>
+void function_ref_to(bench::state &state)
+{
+    W<int(T)> inner = [](T x) { return work(std::move(x)); };
+    function_ref<int(T)> fn = inner;
+    call_loop<T>(state, fn);
+}
+
+// Testing whether a wrapper holding a lambda is empty
+template<template<class> class W> void test_empty(bench::state &state)
+{
+    W<int(int)> fn = [](int x) { return work(x); };
+    for (auto _ : state)
+    {
+        bench::do_not_optimize(fn);
+        bench::do_not_optimize(static_cast<bool>(fn));
+    }
+}
+
+BENCHMARK(function_pointer<int>);
+BENCHMARK(virtual_call<int>);
+
+BENCHMARK(free_function<std_function, int>);
+BENCHMARK(free_function<function_ref, int>);
+BENCHMARK(free_function<move_only_function, int>);
+BENCHMARK(free_function<function, int>);
+BENCHMARK(free_function<copyable_function, int>);
+
+BENCHMARK(unbound_nontype<function_ref, int>);
+BENCHMARK(unbound_nontype<move_only_function, int>);
+BENCHMARK(unbound_nontype<function, int>);
+BENCHMARK(unbound_nontype<copyable_function, int>);
+
+BENCHMARK(bound_member<std_function, int>);
+BENCHMARK(bound_member<function_ref, int>);
+BENCHMARK(bound_member<move_only_function, int>);
+BENCHMARK(bound_member<function, int>);
+BENCHMARK(bound_member<copyable_function, int>);
+
+BENCHMARK(lambda<std_function, int, 0>);
+BENCHMARK(lambda<function_ref, int, 0>);
+BENCHMARK(lambda<move_only_function, int, 0>);
+BENCHMARK(lambda<inplace_move_only_function, int, 0>);
+BENCHMARK(lambda<function, int, 0>);
+BENCHMARK(lambda<copyable_function, int, 0>);
+
+BENCHMARK(lambda<std_function, int, 1>);
+BENCHMARK(lambda<function_ref, int, 1>);
+BENCHMARK(lambda<move_only_function, int, 1>);
+BENCHMARK(lambda<inplace_move_only_function, int, 1>);
+BENCHMARK(lambda<function, int, 1>);
+BENCHMARK(lambda<copyable_function, int, 1>);
+
+BENCHMARK(lambda<std_function, int, 3>);
+BENCHMARK(lambda<function_ref, int, 3>);
+BENCHMARK(lambda<move_only_function, int, 3>);
+BENCHMARK(lambda<inplace_move_only_function, int, 3>);
+BENCHMARK(lambda<function, int, 3>);
+BENCHMARK(lambda<copyable_function, int, 3>);
+
+BENCHMARK(lambda<std_function, int, 8>);
+BENCHMARK(lambda<function_ref, int, 8>);
+BENCHMARK(lambda<move_only_function, int, 8>);
+BENCHMARK(lambda<function, int, 8>);
+BENCHMARK(lambda<copyable_function, int, 8>);
+
+BENCHMARK(function_ref_to<std_function, int>);
+BENCHMARK(function_ref_to<move_only_function, int>);
+BENCHMARK(function_ref_to<function, int>);
+BENCHMARK(function_ref_to<copyable_function, int>);
+
+BENCHMARK(function_pointer<std::string>);
+BENCHMARK(virtual_call<std::string>);
+
+BENCHMARK(free_function<std_function, std::string>);
+BENCHMARK(free_function<function_ref, std::string>);
+BENCHMARK(free_function<move_only_function, std::string>);
+BENCHMARK(free_function<function, std::string>);
+BENCHMARK(free_function<copyable_function, std::string>);
+
+BENCHMARK(unbound_nontype<function_ref, std::string>);
+BENCHMARK(unbound_nontype<move_only_function, std::string>);
+BENCHMARK(unbound_nontype<function, std::string>);
+BENCHMARK(unbound_nontype<copyable_function, std::string>);
+
+BENCHMARK(bound_member<std_function, std::string>);
+BENCHMARK(bound_member<function_ref, std::string>);
+BENCHMARK(bound_member<move_only_function, std::string>);
+BENCHMARK(bound_member<function, std::string>);
+BENCHMARK(bound_member<copyable_function, std::string>);
+
+BENCHMARK(lambda<std_function, std::string, 0>);
+BENCHMARK(lambda<function_ref, std::string, 0>);
+BENCHMARK(lambda<move_only_function, std::string, 0>);
+BENCHMARK(lambda<function, std::string, 0>);
+BENCHMARK(lambda<copyable_function, std::string, 0>);
+
+BENCHMARK(test_empty<std_function>);
+BENCHMARK(test_empty<move_only_function>);
+BENCHMARK(test_empty<function>);
+BENCHMARK(test_empty<copyable_function>);
@@ -0,0 +1,75 @@
+#include "benchmark.h"
+
+#include "std23/dispatch_table.h"
+
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Calling the handler of each of a stream of message IDs, from an array of
+// function_ref filled at run time or from a dispatch_table.  The IDs come in
+// a pseudo-random order.
+
+template<int K> int handle(int x) noexcept
+{
+    return (x ^ K) + K;
+}
+
+template<std::size_t... I>
+constexpr auto make_table(std::index_sequence<I...>)
+{
+    return std23::make_dispatch_table<int(int) noexcept>(
+        std23::nontype<handle<int(I)>>...);
+}
+
+template<std::size_t N> std::vector<std::uint8_t> message_ids()
+{
+    std::vector<std::uint8_t> ids(1024);
+    std::uint32_t seed = 12345;
+    for (auto &id : ids)
+    {
+        seed = seed * 1664525 + 1013904223;
+        id = static_cast<std::uint8_t>((seed >> 16) % N);
+    }
+
+    return ids;
+}
+
+template<std::size_t N> void array_of_function_ref(bench::state &state)
+{
+    using fr = std23::function_ref<int(int) noexcept>;
+    auto build = []<std::size_t... I>(std::index_sequence<I...>)
+    { return std::array<fr, N>{fr(std23::nontype<handle<int(I)>>)...}; };
+    auto handlers = build(std::make_index_sequence<N>());
+    auto ids = message_ids<N>();
+
+    int acc = 0;
+    for (auto _ : state)
+    {
+        bench::do_not_optimize(handlers);
+        for (auto id : ids)
+            acc = handlers[id](acc);
+    }
+    bench::do_not_optimize(acc);
+}
+
+template<std::size_t N> void dispatch_table(bench::state &state)
+{
+    constexpr auto handlers = make_table(std::make_index_sequence<N>());
+    auto ids = message_ids<N>();
+
+    int acc = 0;
+    for (auto _ : state)
+    {
+        for (auto id : ids)
+            acc = handlers(id, acc);
+    }
+    bench::do_not_optimize(acc);
+}
+
+BENCHMARK(array_of_function_ref<4>);
+BENCHMARK(dispatch_table<4>);
+
+BENCHMARK(array_of_function_ref<32>);
+BENCHMARK(dispatch_table<32>);
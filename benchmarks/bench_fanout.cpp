@@ -0,0 +1,91 @@
+#include "benchmark.h"
+
+#include "std23/function_ref.h"
+#include "std23/function_ref_vector.h"
+
+#include <cstdint>
+#include <vector>
+
+// Invoking N callbacks of four interleaved types, from a vector of
+// function_ref or from a function_ref_vector, which groups them by thunk.
+
+template<int K> struct tally
+{
+    int *sum;
+
+    void operator()(int x) const { *sum += x ^ K; }
+};
+
+// The types come in a fixed pseudo-random order, which the branch predictor
+// cannot learn from one call to the next
+template<class Add> void add_targets(Add add, std::vector<int> &sums)
+{
+    static std::vector<tally<0>> t0;
+    static std::vector<tally<1>> t1;
+    static std::vector<tally<2>> t2;
+    static std::vector<tally<3>> t3;
+
+    auto n = sums.size();
+    t0.resize(n);
+    t1.resize(n);
+    t2.resize(n);
+    t3.resize(n);
+
+    std::uint32_t seed = 12345;
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        seed = seed * 1664525 + 1013904223;
+        switch (seed >> 30)
+        {
+        case 0:
+            add(t0[i] = {&sums[i]});
+            break;
+        case 1:
+            add(t1[i] = {&sums[i]});
+            break;
+        case 2:
+            add(t2[i] = {&sums[i]});
+            break;
+        default:
+            add(t3[i] = {&sums[i]});
+        }
+    }
+}
+
+template<std::size_t N> void vector_of_function_ref(bench::state &state)
+{
+    using fr = std23::function_ref<void(int)>;
+    std::vector<int> sums(N);
+    std::vector<fr> v;
+    v.reserve(N);
+    add_targets([&](auto &t) { v.push_back(t); }, sums);
+
+    for (auto _ : state)
+    {
+        bench::do_not_optimize(v);
+        for (auto &f : v)
+            f(1);
+    }
+    bench::do_not_optimize(sums);
+}
+
+template<std::size_t N> void function_ref_vector(bench::state &state)
+{
+    std::vector<int> sums(N);
+    std23::function_ref_vector<void(int)> v;
+    v.reserve(N);
+    add_targets([&](auto &t) { v.push_back(t); }, sums);
+
+    for (auto _ : state)
+    {
+        bench::do_not_optimize(v);
+        v.invoke_all(1);
+    }
+    bench::do_not_optimize(sums);
+}
+
+BENCHMARK(vector_of_function_ref<64>);
+BENCHMARK(function_ref_vector<64>);
+
+BENCHMARK(vector_of_function_ref<4096>);
+BENCHMARK(function_ref_vector<4096>);
@@ -0,0 +1,69 @@
+#include "benchmark.h"
+
+#include "std23/atomic_function.h"
+
+#include <atomic>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+// The cost of calling a callback that another thread may replace, while
+// R other threads call it as well: a move_only_function guarded by a
+// std::shared_mutex, against atomic_function.  Nothing is replaced while
+// measuring; the difference is what the readers pay for allowing it.
+
+using callback = std23::move_only_function<int(int)>;
+
+class locked_function
+{
+    std::shared_mutex mtx_;
+    callback fn_;
+
+  public:
+    explicit locked_function(callback fn) : fn_(std::move(fn)) {}
+
+    int operator()(int x)
+    {
+        std::shared_lock lk(mtx_);
+        return fn_(x);
+    }
+};
+
+using atomic_function = std23::atomic_function<int(int)>;
+
+template<class Holder, int Readers> void readers(bench::state &state)
+{
+    Holder fn(callback([](int x) { return x + 1; }));
+    std::atomic<bool> stop = false;
+
+    std::vector<std::jthread> threads;
+    for (int r = 0; r != Readers; ++r)
+    {
+        threads.emplace_back(
+            [&]
+            {
+                int n = 0;
+                while (not stop.load(std::memory_order_relaxed))
+                    n = fn(n);
+
+                bench::do_not_optimize(n);
+            });
+    }
+
+    int n = 0;
+    for (auto _ : state)
+        n = fn(n);
+
+    stop = true;
+    threads.clear();
+    bench::do_not_optimize(n);
+}
+
+BENCHMARK(readers<locked_function, 0>);
+BENCHMARK(readers<atomic_function, 0>);
+
+BENCHMARK(readers<locked_function, 3>);
+BENCHMARK(readers<atomic_function, 3>);
+
+BENCHMARK(readers<locked_function, 15>);
+BENCHMARK(readers<atomic_function, 15>);
@@ -0,0 +1,120 @@
+#include "common_callables.h"
+
+#include "std23/copyable_function.h"
+#include "std23/function.h"
+#include "std23/function_ref.h"
+#include "std23/inplace_move_only_function.h"
+#include "std23/move_only_function.h"
+
+#include <array>
+#include <functional>
+
+// Cost of constructing, moving, and copying each wrapper holding a lambda
+// that captures N pointers.
+
+template<class S> using function = std23::function<S>;
+template<class S> using copyable_function = std23::copyable_function<S>;
+template<class S> using function_ref = std23::function_ref<S>;
+template<class S> using move_only_function = std23::move_only_function<S>;
+template<class S>
+using inplace_move_only_function = std23::inplace_move_only_function<S>;
+template<class S> using std_function = std::function<S>;
+
+template<std::size_t N> inline auto make_lambda()
+{
+    if constexpr (N == 0)
+        return [](int x) { return work(x); };
+    else
+        return [p = std::array<void *, N>{}](int x)
+        {
+            (void)p;
+            return work(x);
+        };
+}
+
+// Including destruction
+template<template<class> class W, std::size_t N>
+void construct(bench::state &state)
+{
+    auto f = make_lambda<N>();
+    for (auto _ : state)
+    {
+        bench::do_not_optimize(f);
+        W<int(int)> fn = f;
+        bench::do_not_optimize(fn);
+    }
+}
+
+// Move to a new object and back
+template<template<class> class W, std::size_t N>
+void move(bench::state &state)
+{
+    W<int(int)> fn = make_lambda<N>();
+    for (auto _ : state)
+    {
+        W<int(int)> tmp = std::move(fn);
+        bench::do_not_optimize(tmp);
+        fn = std::move(tmp);
+        bench::do_not_optimize(fn);
+    }
+}
+
+// Including destruction of the copy
+template<template<class> class W, std::size_t N>
+void copy(bench::state &state)
+{
+    W<int(int)> fn = make_lambda<N>();
+    for (auto _ : state)
+    {
+        bench::do_not_optimize(fn);
+        W<int(int)> tmp = fn;
+        bench::do_not_optimize(tmp);
+    }
+}
+
+BENCHMARK(construct<std_function, 0>);
+BENCHMARK(construct<function_ref, 0>);
+BENCHMARK(construct<move_only_function, 0>);
+BENCHMARK(construct<inplace_move_only_function, 0>);
+BENCHMARK(construct<function, 0>);
+BENCHMARK(construct<copyable_function, 0>);
+
+BENCHMARK(construct<std_function, 3>);
+BENCHMARK(construct<move_only_function, 3>);
+BENCHMARK(construct<inplace_move_only_function, 3>);
+BENCHMARK(construct<function, 3>);
+BENCHMARK(construct<copyable_function, 3>);
+
+BENCHMARK(construct<std_function, 8>);
+BENCHMARK(construct<move_only_function, 8>);
+BENCHMARK(construct<function, 8>);
+BENCHMARK(construct<copyable_function, 8>);
+
+BENCHMARK(move<std_function, 0>);
+BENCHMARK(move<move_only_function, 0>);
+BENCHMARK(move<inplace_move_only_function, 0>);
+BENCHMARK(move<function, 0>);
+BENCHMARK(move<copyable_function, 0>);
+
+BENCHMARK(move<std_function, 3>);
+BENCHMARK(move<move_only_function, 3>);
+BENCHMARK(move<inplace_move_only_function, 3>);
+BENCHMARK(move<function, 3>);
+BENCHMARK(move<copyable_function, 3>);
+
+BENCHMARK(move<std_function, 8>);
+BENCHMARK(move<move_only_function, 8>);
+BENCHMARK(move<function, 8>);
+BENCHMARK(move<copyable_function, 8>);
+
+BENCHMARK(copy<std_function, 0>);
+BENCHMARK(copy<function, 0>);
+BENCHMARK(copy<copyable_function, 0>);
+
+BENCHMARK(copy<std_function, 3>);
+BENCHMARK(copy<function, 3>);
+BENCHMARK(copy<copyable_function, 3>);
+
+BENCHMARK(copy<std_function, 8>);
+BENCHMARK(copy<function, 8>);
+BENCHMARK(copy<copyable_function, 8>);
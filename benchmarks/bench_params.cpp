@@ -0,0 +1,85 @@
+#include "benchmark.h"
+
+#include "std23/function_ref.h"
+#include "std23/move_only_function.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+// Cost of passing a trivially copyable argument of N bytes through each
+// wrapper when the call thunk takes it by value (the argument is copied
+// into the thunk's frame) or by reference (the thunk reads the caller's
+// copy).  is_passed_by_value picks by value only where the ABI passes the
+// argument in registers: up to 16 bytes on System V x86-64 and AArch64.
+
+template<std::size_t N> struct plain_argument
+{
+    std::uint64_t v[N / sizeof(std::uint64_t)];
+};
+
+template<std::size_t N, bool ByValue>
+struct argument : plain_argument<N>
+{};
+
+template<std::size_t N, bool ByValue>
+struct std23::is_passed_by_value<argument<N, ByValue>>
+    : std::bool_constant<ByValue>
+{};
+
+// Takes small arguments by value and large ones by reference, as targets
+// are commonly written
+template<class T>
+using target_param_t = std::conditional_t<sizeof(T) <= 16, T, T const &>;
+
+template<class T> int sum_ends(target_param_t<T> x)
+{
+    return static_cast<int>(x.v[0] + x.v[std::size(x.v) - 1]);
+}
+
+template<template<class> class W, std::size_t N, bool ByValue>
+void pass_argument(bench::state &state)
+{
+    using T = argument<N, ByValue>;
+    W<int(T)> fn = &sum_ends<T>;
+
+    T arg{};
+    for (auto _ : state)
+    {
+        bench::do_not_optimize(fn);
+        bench::do_not_optimize(arg);
+        bench::do_not_optimize(fn(arg));
+    }
+
+    if (std23::is_passed_by_value_v<plain_argument<N>> == ByValue)
+        state.set_label("default");
+}
+
+template<class S> using function_ref = std23::function_ref<S>;
+template<class S> using move_only_function = std23::move_only_function<S>;
+
+BENCHMARK(pass_argument<function_ref, 8, true>);
+BENCHMARK(pass_argument<function_ref, 8, false>);
+BENCHMARK(pass_argument<move_only_function, 8, true>);
+BENCHMARK(pass_argument<move_only_function, 8, false>);
+
+BENCHMARK(pass_argument<function_ref, 16, true>);
+BENCHMARK(pass_argument<function_ref, 16, false>);
+BENCHMARK(pass_argument<move_only_function, 16, true>);
+BENCHMARK(pass_argument<move_only_function, 16, false>);
+
+BENCHMARK(pass_argument<function_ref, 32, true>);
+BENCHMARK(pass_argument<function_ref, 32, false>);
+BENCHMARK(pass_argument<move_only_function, 32, true>);
+BENCHMARK(pass_argument<move_only_function, 32, false>);
+
+BENCHMARK(pass_argument<function_ref, 64, true>);
+BENCHMARK(pass_argument<function_ref, 64, false>);
+BENCHMARK(pass_argument<move_only_function, 64, true>);
+BENCHMARK(pass_argument<move_only_function, 64, false>);
+
+BENCHMARK(pass_argument<function_ref, 256, true>);
+BENCHMARK(pass_argument<function_ref, 256, false>);
+BENCHMARK(pass_argument<move_only_function, 256, true>);
+BENCHMARK(pass_argument<move_only_function, 256, false>);
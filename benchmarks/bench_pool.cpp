@@ -0,0 +1,63 @@
+#include "benchmark.h"
+
+#include "std23/thread_pool.h"
+
+#include <atomic>
+#include <cstdint>
+
+// How thread_pool scales with its number of workers.  Each iteration runs
+// a fork-join of 256 tasks of about a microsecond each: one task submitted
+// from outside splits the range in halves until the leaves do the work, and
+// the idle workers steal the halves.  Compare the results against the
+// number of cores of the machine.
+
+struct fork_join
+{
+    std23::thread_pool &pool;
+    std::atomic<int> &pending;
+
+    static std::uint32_t work(std::uint32_t x) noexcept
+    {
+        for (int i = 0; i != 500; ++i)
+            x = x * 1664525u + 1013904223u;
+
+        return x;
+    }
+
+    void operator()(int first, int last) const
+    {
+        while (last - first > 1)
+        {
+            auto mid = first + (last - first) / 2;
+            pool.submit([*this, mid, last] { (*this)(mid, last); });
+            last = mid;
+        }
+
+        bench::do_not_optimize(work(static_cast<std::uint32_t>(first)));
+        if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            pending.notify_one();
+    }
+};
+
+template<unsigned Workers> void workers(bench::state &state)
+{
+    constexpr int tasks = 256;
+
+    std23::thread_pool pool(Workers);
+    std::atomic<int> pending;
+    fork_join job{pool, pending};
+
+    for (auto _ : state)
+    {
+        pending = tasks;
+        pool.submit([job] { job(0, tasks); });
+        for (int n; (n = pending.load()) != 0;)
+            pending.wait(n);
+    }
+}
+
+BENCHMARK(workers<1>);
+BENCHMARK(workers<2>);
+BENCHMARK(workers<4>);
+BENCHMARK(workers<8>);
+BENCHMARK(workers<16>);
@@ -0,0 +1,108 @@
+#include "benchmark.h"
+
+#include "std23/task_queue.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+// Throughput of handing tasks from P producer threads to one consumer,
+// through task_queue or through a std::deque guarded by a std::mutex.  Each
+// iteration runs one task on the consumer; both queues are bounded to the
+// same capacity and popped in batches.
+
+using task = std23::move_only_function<void() &&>;
+
+class locked_queue
+{
+    std::mutex mtx_;
+    std::deque<task> tasks_;
+    std::size_t capacity_;
+
+  public:
+    explicit locked_queue(std::size_t capacity) : capacity_(capacity) {}
+
+    bool try_push(task &&fn)
+    {
+        std::lock_guard lk(mtx_);
+        if (tasks_.size() == capacity_)
+            return false;
+
+        tasks_.push_back(std::move(fn));
+        return true;
+    }
+
+    std::size_t try_pop(std::span<task> out)
+    {
+        std::lock_guard lk(mtx_);
+        auto n = std::min(out.size(), tasks_.size());
+        auto last = tasks_.begin() + static_cast<std::ptrdiff_t>(n);
+        std::move(tasks_.begin(), last, out.begin());
+        tasks_.erase(tasks_.begin(), last);
+        return n;
+    }
+};
+
+using lock_free_queue = std23::task_queue<void() &&>;
+
+template<class Queue, int Producers> void producers(bench::state &state)
+{
+    Queue q(1024);
+    std::atomic<bool> stop = false;
+    int ran = 0;
+
+    std::vector<std::jthread> threads;
+    for (int p = 0; p != Producers; ++p)
+    {
+        threads.emplace_back(
+            [&]
+            {
+                while (not stop.load(std::memory_order_relaxed))
+                {
+                    task fn = [&ran] { ++ran; };
+                    while (not q.try_push(std::move(fn)))
+                    {
+                        if (stop.load(std::memory_order_relaxed))
+                            return;
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+
+    std::array<task, 64> batch;
+    std::size_t i = 0, n = 0;
+    for (auto _ : state)
+    {
+        while (i == n)
+        {
+            i = 0;
+            n = q.try_pop(batch);
+            if (n == 0)
+                std::this_thread::yield();
+        }
+
+        std::move(batch[i++])();
+    }
+
+    stop = true;
+    threads.clear();
+    bench::do_not_optimize(ran);
+}
+
+BENCHMARK(producers<locked_queue, 1>);
+BENCHMARK(producers<lock_free_queue, 1>);
+
+BENCHMARK(producers<locked_queue, 4>);
+BENCHMARK(producers<lock_free_queue, 4>);
+
+BENCHMARK(producers<locked_queue, 16>);
+BENCHMARK(producers<lock_free_queue, 16>);
+
+BENCHMARK(producers<locked_queue, 64>);
+BENCHMARK(producers<lock_free_queue, 64>);
@@ -0,0 +1,64 @@
+#include "benchmark.h"
+
+#include "std23/unbound_function_ref.h"
+
+#include <cstdint>
+#include <vector>
+
+// Invoking a large array of callbacks to unbound NTTP callables, held as
+// function_ref or as unbound_function_ref, which is half the size.
+
+template<int K> int step(int x) noexcept
+{
+    return x + K;
+}
+
+template<class Ref> std::vector<Ref> callbacks(std::size_t n)
+{
+    std::vector<Ref> v;
+    v.reserve(n);
+    std::uint32_t seed = 12345;
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        seed = seed * 1664525 + 1013904223;
+        switch (seed >> 30)
+        {
+        case 0:
+            v.push_back(std23::nontype<step<0>>);
+            break;
+        case 1:
+            v.push_back(std23::nontype<step<1>>);
+            break;
+        case 2:
+            v.push_back(std23::nontype<step<2>>);
+            break;
+        default:
+            v.push_back(std23::nontype<step<3>>);
+        }
+    }
+
+    return v;
+}
+
+template<class Ref, std::size_t N> void invoke_array(bench::state &state)
+{
+    auto v = callbacks<Ref>(N);
+
+    int acc = 0;
+    for (auto _ : state)
+    {
+        bench::do_not_optimize(v);
+        for (auto &f : v)
+            acc = f(acc);
+    }
+    bench::do_not_optimize(acc);
+}
+
+using two_pointers = std23::function_ref<int(int) noexcept>;
+using one_pointer = std23::unbound_function_ref<int(int) noexcept>;
+
+BENCHMARK(invoke_array<two_pointers, 4096>);
+BENCHMARK(invoke_array<one_pointer, 4096>);
+
+BENCHMARK(invoke_array<two_pointers, 1 << 20>);
+BENCHMARK(invoke_array<one_pointer, 1 << 20>);
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <atomic>
+#endif
+
+// A small subset of the Google Benchmark interface.  Each benchmark is a
+// function taking bench::state & and containing a `for (auto _ : state)`
+// loop; only the loop is timed.
+
+namespace bench
+{
+
+class state
+{
+    using clock = std::chrono::steady_clock;
+
+    std::int64_t iterations_;
+    clock::duration real_{};
+    std::clock_t cpu_{};
+    clock::time_point real_start_;
+    std::clock_t cpu_start_{};
+    std::string label_;
+    bool running_ = false;
+
+  public:
+    explicit state(std::int64_t iterations) noexcept : iterations_(iterations)
+    {}
+
+    struct iterator
+    {
+        state *st;
+        std::int64_t remaining;
+
+        bool operator!=(iterator const &) noexcept
+        {
+            if (remaining != 0)
+                return true;
+
+            st->pause_timing();
+            return false;
+        }
+
+        iterator &operator++() noexcept
+        {
+            --remaining;
+            return *this;
+        }
+
+        struct [[maybe_unused]] value_type
+        {
+        };
+
+        value_type operator*() const noexcept { return {}; }
+    };
+
+    iterator begin() noexcept
+    {
+        resume_timing();
+        return {this, iterations_};
+    }
+
+    iterator end() noexcept { return {this, 0}; }
+
+    void pause_timing() noexcept
+    {
+        if (std::exchange(running_, false))
+        {
+            real_ += clock::now() - real_start_;
+            cpu_ += std::clock() - cpu_start_;
+        }
+    }
+
+    void resume_timing() noexcept
+    {
+        running_ = true;
+        cpu_start_ = std::clock();
+        real_start_ = clock::now();
+    }
+
+    std::int64_t iterations() const noexcept { return iterations_; }
+
+    void set_label(std::string label) { label_ = std::move(label); }
+    std::string const &label() const noexcept { return label_; }
+
+    double real_seconds() const noexcept
+    {
+        return std::chrono::duration<double>(real_).count();
+    }
+
+    double cpu_seconds() const noexcept
+    {
+        return static_cast<double>(cpu_) / CLOCKS_PER_SEC;
+    }
+};
+
+// Keep the compiler from discarding or constant-folding a value
+template<class T> inline void do_not_optimize(T const &value)
+{
+#ifdef _MSC_VER
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    (void)*reinterpret_cast<char const volatile *>(&value);
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#else
+    if constexpr (std::is_trivially_copyable_v<T> and
+                  sizeof(T) <= sizeof(void *))
+        asm volatile("" : : "r,m"(value) : "memory");
+    else
+        asm volatile("" : : "m"(value) : "memory");
+#endif
+}
+
+// Make the compiler assume that the value may have been modified
+template<class T> inline void do_not_optimize(T &value)
+{
+#ifdef _MSC_VER
+    do_not_optimize(static_cast<T const &>(value));
+#else
+    if constexpr (std::is_trivially_copyable_v<T> and
+                  sizeof(T) <= sizeof(void *))
+        asm volatile("" : "+r,m"(value) : : "memory");
+    else
+        asm volatile("" : "+m"(value) : : "memory");
+#endif
+}
+
+using benchmark_function = void(state &);
+
+struct benchmark_info
+{
+    std::string name;
+    benchmark_function *fn;
+};
+
+inline std::vector<benchmark_info> &registry()
+{
+    static std::vector<benchmark_info> benchmarks;
+    return benchmarks;
+}
+
+struct registration
+{
+    registration(char const *name, benchmark_function *fn)
+    {
+        registry().push_back({name, fn});
+    }
+};
+
+int run_specified_benchmarks(int argc, char *argv[]);
+
+} // namespace bench
+
+#define BENCH_CONCAT_IMPL(a, b) a##b
+#define BENCH_CONCAT(a, b) BENCH_CONCAT_IMPL(a, b)
+
+// BENCHMARK(fn) or BENCHMARK(fn<Args...>)
+#define BENCHMARK(...)                                                         \
+    static ::bench::registration BENCH_CONCAT(bench_registration_,             \
+                                              __LINE__)(#__VA_ARGS__,          \
+                                                        __VA_ARGS__)
@@ -0,0 +1,31 @@
+#include "common_callables.h"
+
+template<class T> int work(T x)
+{
+    if constexpr (std::is_same_v<T, std::string>)
+        return static_cast<int>(x.size());
+    else
+        return x + 1;
+}
+
+template<class T> int worker::work(T x) const
+{
+    return base + ::work(std::move(x));
+}
+
+template<class T> struct work_callback final : callback<T>
+{
+    int operator()(T x) override { return work(std::move(x)); }
+};
+
+template<class T> std::unique_ptr<callback<T>> make_callback()
+{
+    return std::make_unique<work_callback<T>>();
+}
+
+template int work(int);
+template int work(std::string);
+template int worker::work(int) const;
+template int worker::work(std::string) const;
+template std::unique_ptr<callback<int>> make_callback();
+template std::unique_ptr<callback<std::string>> make_callback();
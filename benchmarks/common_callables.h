@@ -0,0 +1,34 @@
+#pragma once
+
+#include "benchmark.h"
+
+#include <memory>
+#include <string>
+
+// Defined out-of-line so that call sites cannot see the bodies
+
+template<class T> int work(T x);
+
+struct worker
+{
+    int base = 1;
+
+    template<class T> int work(T x) const;
+};
+
+template<class T> struct callback
+{
+    virtual int operator()(T x) = 0;
+    virtual ~callback() = default;
+};
+
+template<class T> std::unique_ptr<callback<T>> make_callback();
+
+// Arguments passed to the targets in each iteration
+template<class T> inline T make_argument()
+{
+    if constexpr (std::is_same_v<T, std::string>)
+        return "nontype"; // fits in SSO
+    else
+        return 42;
+}
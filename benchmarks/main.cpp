@@ -0,0 +1,325 @@
+#include "benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <thread>
+
+namespace bench
+{
+
+namespace
+{
+
+struct options
+{
+    std::string filter = ".";
+    std::string format = "console";
+    std::string out;
+    double min_time = 0.5;
+    int repetitions = 1;
+    bool list_only = false;
+};
+
+struct run_result
+{
+    std::string name;
+    std::string run_name;
+    std::string run_type = "iteration";
+    std::string aggregate_name;
+    int repetitions = 1;
+    int repetition_index = 0;
+    std::int64_t iterations = 0;
+    double real_time = 0; // in ns per iteration
+    double cpu_time = 0;
+    std::string label;
+};
+
+bool parse_flag(char const *arg, char const *flag, std::string &value)
+{
+    auto n = std::strlen(flag);
+    if (std::strncmp(arg, flag, n) != 0 or arg[n] != '=')
+        return false;
+
+    value = arg + n + 1;
+    return true;
+}
+
+options parse_options(int argc, char *argv[])
+{
+    options opts;
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string value;
+        if (parse_flag(argv[i], "--benchmark_filter", value))
+            opts.filter = value;
+        else if (parse_flag(argv[i], "--benchmark_format", value))
+            opts.format = value;
+        else if (parse_flag(argv[i], "--benchmark_out", value))
+            opts.out = value;
+        else if (parse_flag(argv[i], "--benchmark_min_time", value))
+            opts.min_time = std::stod(value); // also accepts "0.5s"
+        else if (parse_flag(argv[i], "--benchmark_repetitions", value))
+            opts.repetitions = std::max(std::stoi(value), 1);
+        else if (std::strcmp(argv[i], "--benchmark_list_tests") == 0)
+            opts.list_only = true;
+        else
+        {
+            std::cerr << "usage: " << argv[0]
+                      << " [--benchmark_filter=<regex>]"
+                         " [--benchmark_format=<console|json>]"
+                         " [--benchmark_out=<filename>]"
+                         " [--benchmark_min_time=<seconds>]"
+                         " [--benchmark_repetitions=<n>]"
+                         " [--benchmark_list_tests]\n";
+            std::exit(EXIT_FAILURE);
+        }
+    }
+
+    if (opts.format != "console" and opts.format != "json")
+    {
+        std::cerr << "unknown format: " << opts.format << '\n';
+        std::exit(EXIT_FAILURE);
+    }
+
+    return opts;
+}
+
+// Grow the iteration count until a run takes at least min_time
+run_result run_one(benchmark_info const &bm, double min_time)
+{
+    std::int64_t iters = 1;
+    for (;;)
+    {
+        state st(iters);
+        bm.fn(st);
+
+        auto elapsed = st.real_seconds();
+        if (elapsed >= min_time or iters >= 1'000'000'000)
+        {
+            auto n = static_cast<double>(iters);
+            run_result r;
+            r.name = r.run_name = bm.name;
+            r.iterations = iters;
+            r.real_time = elapsed * 1e9 / n;
+            r.cpu_time = st.cpu_seconds() * 1e9 / n;
+            r.label = st.label();
+            return r;
+        }
+
+        double multiplier = elapsed <= min_time / 10
+                                ? 10
+                                : std::max(min_time * 1.4 / elapsed, 1.1);
+        auto next = static_cast<double>(iters) * multiplier;
+        iters = std::max(static_cast<std::int64_t>(next), iters + 1);
+    }
+}
+
+std::vector<run_result> aggregate(std::vector<run_result> const &runs)
+{
+    auto n = static_cast<double>(runs.size());
+    auto stat = [&](std::string const &name, auto fn)
+    {
+        run_result r = runs.front();
+        r.name = r.run_name + '_' + name;
+        r.run_type = "aggregate";
+        r.aggregate_name = name;
+        r.repetitions = static_cast<int>(runs.size());
+        r.iterations = static_cast<std::int64_t>(runs.size());
+        r.real_time = fn(&run_result::real_time);
+        r.cpu_time = fn(&run_result::cpu_time);
+        return r;
+    };
+
+    auto mean = [&](double run_result::*m)
+    {
+        double sum = 0;
+        for (auto &r : runs)
+            sum += r.*m;
+        return sum / n;
+    };
+
+    auto median = [&](double run_result::*m)
+    {
+        std::vector<double> v;
+        for (auto &r : runs)
+            v.push_back(r.*m);
+        std::sort(v.begin(), v.end());
+        auto mid = v.size() / 2;
+        return v.size() % 2 ? v[mid] : (v[mid - 1] + v[mid]) / 2;
+    };
+
+    auto stddev = [&](double run_result::*m)
+    {
+        auto mu = mean(m);
+        double sum = 0;
+        for (auto &r : runs)
+            sum += (r.*m - mu) * (r.*m - mu);
+        return std::sqrt(sum / (n - 1));
+    };
+
+    return {stat("mean", mean), stat("median", median),
+            stat("stddev", stddev)};
+}
+
+std::string json_escape(std::string const &s)
+{
+    std::string out;
+    for (char c : s)
+    {
+        if (c == '"' or c == '\\')
+            out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+void write_json(std::ostream &os, char const *executable,
+                std::vector<run_result> const &results)
+{
+    char date[64];
+    auto now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S",
+                  std::localtime(&now));
+
+    os << "{\n"
+       << "  \"context\": {\n"
+       << "    \"date\": \"" << date << "\",\n"
+       << "    \"executable\": \"" << json_escape(executable) << "\",\n"
+       << "    \"num_cpus\": " << std::thread::hardware_concurrency()
+       << ",\n"
+#ifdef NDEBUG
+       << "    \"library_build_type\": \"release\"\n"
+#else
+       << "    \"library_build_type\": \"debug\"\n"
+#endif
+       << "  },\n"
+       << "  \"benchmarks\": [";
+
+    char const *sep = "\n";
+    for (auto &r : results)
+    {
+        os << sep << "    {\n"
+           << "      \"name\": \"" << json_escape(r.name) << "\",\n"
+           << "      \"run_name\": \"" << json_escape(r.run_name) << "\",\n"
+           << "      \"run_type\": \"" << r.run_type << "\",\n"
+           << "      \"repetitions\": " << r.repetitions << ",\n"
+           << "      \"repetition_index\": " << r.repetition_index << ",\n";
+        if (r.run_type == "aggregate")
+            os << "      \"aggregate_name\": \"" << r.aggregate_name
+               << "\",\n";
+        os << "      \"threads\": 1,\n"
+           << "      \"iterations\": " << r.iterations << ",\n"
+           << "      \"real_time\": " << r.real_time << ",\n"
+           << "      \"cpu_time\": " << r.cpu_time << ",\n";
+        if (not r.label.empty())
+            os << "      \"label\": \"" << json_escape(r.label) << "\",\n";
+        os << "      \"time_unit\": \"ns\"\n"
+           << "    }";
+        sep = ",\n";
+    }
+
+    os << "\n  ]\n}\n";
+}
+
+void write_console_header(std::size_t width)
+{
+#ifndef NDEBUG
+    std::printf("***WARNING*** Benchmarks were built as DEBUG. "
+                "Timings may be affected.\n");
+#endif
+    std::printf("%-*s %13s %13s %12s\n", static_cast<int>(width), "Benchmark",
+                "Time", "CPU", "Iterations");
+    std::printf("%s\n", std::string(width + 41, '-').c_str());
+}
+
+void write_console(run_result const &r, std::size_t width)
+{
+    std::printf("%-*s %10.2f ns %10.2f ns %12lld %s\n",
+                static_cast<int>(width), r.name.c_str(), r.real_time,
+                r.cpu_time, static_cast<long long>(r.iterations),
+                r.label.c_str());
+    std::fflush(stdout);
+}
+
+} // namespace
+
+int run_specified_benchmarks(int argc, char *argv[])
+{
+    auto opts = parse_options(argc, argv);
+    std::regex re(opts.filter);
+
+    std::vector<benchmark_info> selected;
+    for (auto &bm : registry())
+        if (std::regex_search(bm.name, re))
+            selected.push_back(bm);
+
+    if (opts.list_only)
+    {
+        for (auto &bm : selected)
+            std::cout << bm.name << '\n';
+        return 0;
+    }
+
+    std::size_t width = 10;
+    for (auto &bm : selected)
+        width = std::max(width, bm.name.size() + 8);
+
+    bool console = opts.format == "console";
+    if (console)
+        write_console_header(width);
+
+    std::vector<run_result> results;
+    for (auto &bm : selected)
+    {
+        std::vector<run_result> runs;
+        for (int i = 0; i < opts.repetitions; ++i)
+        {
+            auto r = run_one(bm, opts.min_time);
+            r.repetitions = opts.repetitions;
+            r.repetition_index = i;
+            if (console)
+                write_console(r, width);
+            runs.push_back(std::move(r));
+        }
+
+        results.insert(results.end(), runs.begin(), runs.end());
+        if (runs.size() > 1)
+        {
+            for (auto &r : aggregate(runs))
+            {
+                if (console)
+                    write_console(r, width);
+                results.push_back(std::move(r));
+            }
+        }
+    }
+
+    if (not console)
+        write_json(std::cout, argv[0], results);
+
+    if (not opts.out.empty())
+    {
+        std::ofstream ofs(opts.out);
+        if (not ofs)
+        {
+            std::cerr << "cannot open " << opts.out << '\n';
+            return EXIT_FAILURE;
+        }
+        write_json(ofs, argv[0], results);
+    }
+
+    return 0;
+}
+
+} // namespace bench
+
+int main(int argc, char *argv[])
+{
+    return bench::run_specified_benchmarks(argc, argv);
+}
@@ -1,7 +1,9 @@
 #ifndef INCLUDE_STD23____FUNCTIONAL__BASE
 #define INCLUDE_STD23____FUNCTIONAL__BASE
 
+#include <cstddef>
 #include <functional>
+#include <memory>
 #include <utility>
 
 namespace std23
@@ -31,10 +33,44 @@ constexpr R invoke_r(F &&f, Args &&...args) // freestanding
 }
 
 // See also: https://www.agner.org/optimize/calling_conventions.pdf
+//
+// Both the System V x86-64 and the AArch64 ABIs pass a trivially copyable
+// class of up to two registers in registers; Windows x64 passes only those
+// of 1, 2, 4, or 8 bytes in a register, and copies the others to the stack
+// to pass a pointer to the copy.  Larger classes are better passed by
+// reference, as the thunk would otherwise copy them once more.
+template<class T>
+inline constexpr bool _fits_param_registers = []
+{
+    if constexpr (std::is_scalar_v<T>)
+        return true;
+    else if constexpr (not std::is_trivially_copyable_v<T>)
+        return false;
+#if defined(_WIN64)
+    else
+        return sizeof(T) <= sizeof(void *) and
+               (sizeof(T) & (sizeof(T) - 1)) == 0;
+#else
+    else
+        return sizeof(T) <= 2 * sizeof(void *);
+#endif
+}();
+
+// Whether the call wrappers pass an argument of type T to their targets by
+// value rather than by reference.  Specialize this for your own trivially
+// copyable types to trade the copy of a large argument for an indirection,
+// or the other way around; other types are always passed by reference.
+template<class T>
+struct is_passed_by_value : std::bool_constant<_fits_param_registers<T>>
+{};
+
+template<class T>
+inline constexpr bool is_passed_by_value_v = is_passed_by_value<T>::value;
+
 template<class T>
 inline constexpr auto _select_param_type = []
 {
-    if constexpr (std::is_trivially_copyable_v<T>)
+    if constexpr (std::is_trivially_copyable_v<T> and is_passed_by_value_v<T>)
         return std::type_identity<T>();
     else
         return std::add_rvalue_reference<T>();
@@ -43,6 +79,107 @@ inline constexpr auto _select_param_type = []
 template<class T>
 using _param_t = std::invoke_result_t<decltype(_select_param_type<T>)>::type;
 
+// Whether moving an object to another location and then destroying the
+// source has the same effect as copying its bytes.  Specialize this for your
+// own types to let the wrappers relocate them with memcpy.
+template<class T>
+struct is_trivially_relocatable
+    : std::bool_constant<std::is_trivially_copyable_v<T>>
+{};
+
+template<class T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
+template<class T, std::size_t Size, std::size_t Align>
+inline constexpr bool _is_inline_storable =
+    std::is_object_v<T> and not std::is_pointer_v<T> and
+    std::is_same_v<std::unwrap_reference_t<T>, T> and sizeof(T) <= Size and
+    alignof(T) <= Align and std::is_nothrow_move_constructible_v<T>;
+
+// Whether any T behaves as any other T, so that the wrappers can call one
+// shared T rather than store their own
+template<class T>
+inline constexpr bool _is_stateless =
+    std::is_empty_v<T> and std::is_trivially_default_constructible_v<T> and
+    std::is_trivially_copyable_v<T>;
+
+// Outlives every call, so that what a call returns may refer to it
+template<class T> inline constinit T _stateless_object{};
+
+// An NTTP callable that calls the shared T as a Fp, for wrappers to handle
+// stateless callables in the same way as unbound NTTP callables
+template<class T, class Fp = T &>
+inline constexpr auto _stateless_call = [](auto &&...args) noexcept(
+    std::is_nothrow_invocable_v<Fp, decltype(args)...>) -> decltype(auto)
+{
+    return std::invoke(static_cast<Fp>(_stateless_object<T>),
+                       decltype(args)(args)...);
+};
+
+// Shared by function_ref and move_only_function so that the latter's call
+// thunks can be used by the former
+struct _function_ref_base
+{
+    union storage
+    {
+        void *p_ = nullptr;
+        void const *cp_;
+        void (*fp_)();
+
+        constexpr storage() noexcept = default;
+
+        template<class T> requires std::is_object_v<T>
+        constexpr explicit storage(T *p) noexcept : p_(p)
+        {}
+
+        template<class T> requires std::is_object_v<T>
+        constexpr explicit storage(T const *p) noexcept : cp_(p)
+        {}
+
+        template<class T> requires std::is_function_v<T>
+        constexpr explicit storage(T *p) noexcept
+            : fp_(reinterpret_cast<decltype(fp_)>(p))
+        {}
+    };
+
+    template<class T> constexpr static auto get(storage obj)
+    {
+        if constexpr (std::is_const_v<T>)
+            return static_cast<T *>(obj.cp_);
+        else if constexpr (std::is_object_v<T>)
+            return static_cast<T *>(obj.p_);
+        else
+            return reinterpret_cast<T *>(obj.fp_);
+    }
+};
+
+// The operations on an owned target that do not depend on the signature,
+// so that a move_only_function can adopt the target of another wrapper
+struct _move_only_ops
+{
+    using handle = _function_ref_base::storage;
+
+    typedef void destroy_t(handle) noexcept;
+    typedef auto relocate_t(handle, void *) noexcept -> handle;
+
+    destroy_t *destroy = [](handle) noexcept {};
+    relocate_t *relocate = nullptr; // null if the handle is the target
+};
+
+// A target given up by one wrapper, along with its call thunk
+template<class Call> struct _released_target
+{
+    Call *call;
+    _move_only_ops const *ops;
+    _function_ref_base::storage obj;
+};
+
+template<class Sig, class> class function_ref;
+template<class Sig, class> class unbound_function_ref;
+template<class S, class> class function;
+template<class S, class> class copyable_function;
+
 template<class T, class Self>
 inline constexpr bool _is_not_self =
     not std::is_same_v<std::remove_cvref_t<T>, Self>;
@@ -222,6 +359,237 @@ struct _drop_first_arg_to_invoke<M G::*, T> : _not_qualifying_this<M>
 template<class F, class T>
 using _drop_first_arg_to_invoke_t = _drop_first_arg_to_invoke<F, T>::type;
 
+template<class Sig> struct _cv_fn_sig
+{};
+
+template<class R, class... Args> struct _cv_fn_sig<R(Args...)>
+{
+    using function = R(Args...);
+    template<class T> using cv = T;
+};
+
+template<class R, class... Args> struct _cv_fn_sig<R(Args...) const>
+{
+    using function = R(Args...);
+    template<class T> using cv = T const;
+};
+
+template<class Sig> struct _ref_quals_fn_sig : _cv_fn_sig<Sig>
+{
+    template<class T> using ref = T;
+};
+
+template<class R, class... Args>
+struct _ref_quals_fn_sig<R(Args...) &> : _cv_fn_sig<R(Args...)>
+{
+    template<class T> using ref = T &;
+};
+
+template<class R, class... Args>
+struct _ref_quals_fn_sig<R(Args...) const &> : _cv_fn_sig<R(Args...) const>
+{
+    template<class T> using ref = T &;
+};
+
+template<class R, class... Args>
+struct _ref_quals_fn_sig<R(Args...) &&> : _cv_fn_sig<R(Args...)>
+{
+    template<class T> using ref = T &&;
+};
+
+template<class R, class... Args>
+struct _ref_quals_fn_sig<R(Args...) const &&> : _cv_fn_sig<R(Args...) const>
+{
+    template<class T> using ref = T &&;
+};
+
+template<bool V> struct _noex_traits
+{
+    static constexpr bool is_noexcept = V;
+};
+
+template<class Sig>
+struct _full_fn_sig : _ref_quals_fn_sig<Sig>, _noex_traits<false>
+{};
+
+template<class R, class... Args>
+struct _full_fn_sig<R(Args...) noexcept> : _ref_quals_fn_sig<R(Args...)>,
+                                           _noex_traits<true>
+{};
+
+template<class R, class... Args>
+struct _full_fn_sig<R(Args...) & noexcept> : _ref_quals_fn_sig<R(Args...) &>,
+                                             _noex_traits<true>
+{};
+
+template<class R, class... Args>
+struct _full_fn_sig<R(Args...) && noexcept> : _ref_quals_fn_sig<R(Args...) &&>,
+                                              _noex_traits<true>
+{};
+
+template<class R, class... Args>
+struct _full_fn_sig<R(Args...) const noexcept>
+    : _ref_quals_fn_sig<R(Args...) const>, _noex_traits<true>
+{};
+
+template<class R, class... Args>
+struct _full_fn_sig<R(Args...) const & noexcept>
+    : _ref_quals_fn_sig<R(Args...) const &>, _noex_traits<true>
+{};
+
+template<class R, class... Args>
+struct _full_fn_sig<R(Args...) const && noexcept>
+    : _ref_quals_fn_sig<R(Args...) const &&>, _noex_traits<true>
+{};
+
+constexpr inline struct
+{
+    constexpr auto operator()(auto &&rhs) const
+    {
+        return new auto(decltype(rhs)(rhs));
+    }
+
+    constexpr auto operator()(auto *rhs) const noexcept { return rhs; }
+
+    template<class T>
+    constexpr auto operator()(std::reference_wrapper<T> rhs) const noexcept
+    {
+        return std::addressof(rhs.get());
+    }
+
+} _take_reference;
+
+template<class T>
+constexpr auto _build_reference = [](auto &&...args)
+{ return new T(decltype(args)(args)...); };
+
+template<class T>
+constexpr auto _build_reference<T *> = [](auto &&...args) noexcept -> T *
+{ return {decltype(args)(args)...}; };
+
+template<class T>
+constexpr auto _build_reference<std::reference_wrapper<T>> =
+    [](auto &rhs) noexcept { return std::addressof(rhs); };
+
+// Storage for a target inside an owning wrapper, which holds targets that do
+// not fit in it by reference
+template<std::size_t Size, std::size_t Align> struct _target_buffer
+{
+    alignas(Align) std::byte bytes[Size];
+
+    template<class T>
+    static constexpr bool is_stored_inline =
+        _is_inline_storable<T, Size, Align>;
+
+    template<class T, class F>
+    static constexpr bool is_nothrow_taken =
+        is_stored_inline<T>
+            ? std::is_nothrow_constructible_v<T, F>
+            : std::is_nothrow_invocable_v<decltype(_take_reference), F>;
+
+    template<class T, class... Inits>
+    static constexpr bool is_nothrow_built =
+        is_stored_inline<T>
+            ? std::is_nothrow_constructible_v<T, Inits...>
+            : std::is_nothrow_invocable_v<decltype(_build_reference<T>),
+                                          Inits...>;
+
+    // Constructs the target at to if it is stored inline
+    template<class T, class F>
+    static auto take_target(void *to, F &&f) noexcept(is_nothrow_taken<T, F>)
+    {
+        if constexpr (is_stored_inline<T>)
+            return ::new (to) T(std::forward<F>(f));
+        else
+            return _take_reference(std::forward<F>(f));
+    }
+
+    template<class T, class... Inits>
+    static auto build_target(void *to, Inits &&...inits) noexcept(
+        is_nothrow_built<T, Inits...>)
+    {
+        if constexpr (is_stored_inline<T>)
+            return ::new (to) T(std::forward<Inits>(inits)...);
+        else
+            return _build_reference<T>(std::forward<Inits>(inits)...);
+    }
+};
+
+template<class Self, class S, class = typename _full_fn_sig<S>::function>
+class _owning_function_base;
+
+// The call operators of an owning wrapper Self, which call the thunk and the
+// handle returned by Self::direct_call with the qualifiers in S.  An empty
+// wrapper is one whose thunk is null.
+template<class Self, class S, class R, class... Args>
+class _owning_function_base<Self, S, R(Args...)>
+{
+    using signature = _full_fn_sig<S>;
+
+    template<class T> using cv = signature::template cv<T>;
+    template<class T> using ref = signature::template ref<T>;
+
+    static constexpr bool noex = signature::is_noexcept;
+    static constexpr bool is_const = std::is_same_v<cv<void>, void const>;
+    static constexpr bool is_lvalue_only = std::is_same_v<ref<int>, int &>;
+    static constexpr bool is_rvalue_only = std::is_same_v<ref<int>, int &&>;
+
+    auto direct_call() const noexcept
+    {
+        return static_cast<Self const &>(*this).direct_call();
+    }
+
+  public:
+    explicit operator bool() const noexcept
+    {
+        return direct_call().first != nullptr;
+    }
+
+    friend bool operator==(Self const &f, nullptr_t) noexcept { return !f; }
+
+    R operator()(Args... args) noexcept(noex)
+        requires(!is_const and !is_lvalue_only and !is_rvalue_only)
+    {
+        auto [call, obj] = direct_call();
+        return call(obj, std::forward<Args>(args)...);
+    }
+
+    R operator()(Args... args) const noexcept(noex)
+        requires(is_const and !is_lvalue_only and !is_rvalue_only)
+    {
+        auto [call, obj] = direct_call();
+        return call(obj, std::forward<Args>(args)...);
+    }
+
+    R operator()(Args... args) &noexcept(noex)
+        requires(!is_const and is_lvalue_only and !is_rvalue_only)
+    {
+        auto [call, obj] = direct_call();
+        return call(obj, std::forward<Args>(args)...);
+    }
+
+    R operator()(Args... args) const &noexcept(noex)
+        requires(is_const and is_lvalue_only and !is_rvalue_only)
+    {
+        auto [call, obj] = direct_call();
+        return call(obj, std::forward<Args>(args)...);
+    }
+
+    R operator()(Args... args) &&noexcept(noex)
+        requires(!is_const and !is_lvalue_only and is_rvalue_only)
+    {
+        auto [call, obj] = direct_call();
+        return call(obj, std::forward<Args>(args)...);
+    }
+
+    R operator()(Args... args) const &&noexcept(noex)
+        requires(is_const and !is_lvalue_only and is_rvalue_only)
+    {
+        auto [call, obj] = direct_call();
+        return call(obj, std::forward<Args>(args)...);
+    }
+};
+
 } // namespace std23
 
 #endif
@@ -0,0 +1,139 @@
+#ifndef INCLUDE_STD23_ATOMIC__FUNCTION
+#define INCLUDE_STD23_ATOMIC__FUNCTION
+
+#include "move_only_function.h"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace std23
+{
+
+// Spreads the threads that read the same atomic_function over its stripes
+inline std::size_t _reader_stripe() noexcept
+{
+    static constinit std::atomic<std::size_t> next = 0;
+    thread_local auto const mine = next.fetch_add(1, std::memory_order_relaxed);
+    return mine;
+}
+
+template<class S, class = typename _full_fn_sig<S>::function>
+class atomic_function;
+
+// Holds a move_only_function<S> that many threads may call while another
+// thread replaces it.  Calling takes no lock and never waits: a reader
+// counts itself in the stripe of its thread under the parity of the
+// current epoch.  A writer publishes the new target, then flips the epoch
+// twice, each time waiting for the readers under the old parity to leave,
+// before it reclaims the old target.  The two flips catch the readers that
+// read the epoch before the first flip.
+template<class S, class R, class... Args>
+class atomic_function<S, R(Args...)>
+{
+    using signature = _full_fn_sig<S>;
+
+    template<class T> using cv = signature::template cv<T>;
+    template<class T> using ref = signature::template ref<T>;
+
+    static constexpr bool noex = signature::is_noexcept;
+    static_assert(not std::is_same_v<ref<int>, int &&>,
+                  "a target shared by many callers cannot be called as an "
+                  "rvalue");
+
+  public:
+    using target_type = move_only_function<S>;
+
+  private:
+    struct alignas(64) stripe
+    {
+        std::atomic<std::size_t> readers[2] = {};
+    };
+
+    static constexpr std::size_t stripe_count = 32;
+
+    std::array<stripe, stripe_count> stripes_;
+    std::atomic<target_type *> target_ = nullptr;
+    std::atomic<std::size_t> epoch_ = 0;
+    std::mutex writer_;
+
+    static target_type *make(target_type &&fn)
+    {
+        return fn == nullptr ? nullptr : new target_type(std::move(fn));
+    }
+
+    void synchronize() noexcept
+    {
+        for (int flip = 0; flip != 2; ++flip)
+        {
+            auto old = epoch_.fetch_add(1, std::memory_order_seq_cst) % 2;
+            for (auto &s : stripes_)
+            {
+                while (s.readers[old].load(std::memory_order_seq_cst) != 0)
+                    std::this_thread::yield();
+            }
+        }
+    }
+
+  public:
+    atomic_function() = default;
+
+    template<class F>
+    explicit atomic_function(F &&f)
+        requires std::is_constructible_v<target_type, F>
+        : target_(make(target_type(std::forward<F>(f))))
+    {}
+
+    atomic_function(atomic_function const &) = delete;
+    atomic_function &operator=(atomic_function const &) = delete;
+
+    // No thread may be calling *this
+    ~atomic_function() { delete target_.load(std::memory_order_relaxed); }
+
+    // Returns the old target once no reader can be calling it
+    target_type exchange(target_type fn)
+    {
+        auto p = make(std::move(fn));
+        std::lock_guard _(writer_);
+        std::unique_ptr<target_type> old(
+            target_.exchange(p, std::memory_order_seq_cst));
+        synchronize();
+        return old ? std::move(*old) : target_type();
+    }
+
+    template<class F>
+    void store(F &&f) requires std::is_constructible_v<target_type, F>
+    {
+        exchange(target_type(std::forward<F>(f)));
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return target_.load(std::memory_order_acquire) != nullptr;
+    }
+
+    // Calls the target published last; *this must not be empty
+    R operator()(Args... args) noexcept(noex)
+    {
+        struct reader
+        {
+            std::atomic<std::size_t> &count;
+
+            ~reader() { count.fetch_sub(1, std::memory_order_release); }
+        };
+
+        auto &s = stripes_[_reader_stripe() % stripe_count];
+        auto parity = epoch_.load(std::memory_order_seq_cst) % 2;
+        s.readers[parity].fetch_add(1, std::memory_order_seq_cst);
+        reader _{s.readers[parity]};
+
+        auto &fn = *target_.load(std::memory_order_seq_cst);
+        return static_cast<cv<target_type> &>(fn)(std::forward<Args>(args)...);
+    }
+};
+
+} // namespace std23
+
+#endif
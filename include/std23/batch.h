@@ -0,0 +1,158 @@
+#ifndef INCLUDE_STD23_BATCH
+#define INCLUDE_STD23_BATCH
+
+#include "__functional_base.h"
+
+#include <cassert>
+#include <span>
+#include <tuple>
+#include <utility>
+
+namespace std23
+{
+
+template<class T>
+concept _tuple_like =
+    requires { std::tuple_size<std::remove_cvref_t<T>>::value; };
+
+template<class T> inline constexpr bool _is_span = false;
+template<class T, std::size_t N>
+inline constexpr bool _is_span<std::span<T, N>> = true;
+
+template<class F, class T, class Seq, class... Bound> struct _spread_call;
+
+template<class F, class T, std::size_t... I, class... Bound>
+struct _spread_call<F, T, std::index_sequence<I...>, Bound...>
+{
+    template<std::size_t J>
+    using element = decltype(std::get<J>(std::declval<T>()));
+
+    static constexpr bool spreads = true;
+    static constexpr bool invocable =
+        std::is_invocable_v<F, Bound..., element<I>...>;
+    static constexpr bool nothrow =
+        std::is_nothrow_invocable_v<F, Bound..., element<I>...>;
+};
+
+// How batch<f> passes an element of a span to f: as one argument if f
+// accepts it, or else as the arguments spread from a tuple-like element
+template<class F, class T, class... Bound> struct _element_call
+{
+    static constexpr bool spreads = false;
+    static constexpr bool invocable = std::is_invocable_v<F, Bound..., T>;
+    static constexpr bool nothrow =
+        std::is_nothrow_invocable_v<F, Bound..., T>;
+};
+
+template<class F, class T, class... Bound>
+    requires(not std::is_invocable_v<F, Bound..., T> and _tuple_like<T>)
+struct _element_call<F, T, Bound...>
+    : _spread_call<F, T,
+                   std::make_index_sequence<
+                       std::tuple_size_v<std::remove_cvref_t<T>>>,
+                   Bound...>
+{};
+
+// Calls f once per element of a span.  Bound to a function_ref as
+// nontype<batch<f>>, the loop runs inside the thunk with f inlined, so a
+// batch of callbacks costs one indirect call.  Given a second span, the
+// results of the calls are assigned to its elements.
+template<auto f> struct batch_t
+{
+    explicit batch_t() = default;
+
+  private:
+    using F = decltype(f) const &;
+
+    template<class T, class... Bound>
+    using call = _element_call<F, T, Bound &...>;
+
+    template<class T, class... Bound>
+    static constexpr decltype(auto) each(T &elem, Bound &...obj) noexcept(
+        call<T &, Bound...>::nothrow)
+        requires call<T &, Bound...>::invocable
+    {
+        if constexpr (call<T &, Bound...>::spreads)
+        {
+            using seq = std::make_index_sequence<
+                std::tuple_size_v<std::remove_cv_t<T>>>;
+            return [&]<std::size_t... I>(std::index_sequence<I...>)
+                       -> decltype(auto)
+            { return std::invoke(f, obj..., std::get<I>(elem)...); }(seq());
+        }
+        else
+            return std::invoke(f, obj..., elem);
+    }
+
+    template<class T, class O, class... Bound>
+    static constexpr bool is_storable = requires(T &elem, O &out,
+                                                 Bound &...obj) {
+        out = each(elem, obj...);
+    };
+
+    template<class T, class O, class... Bound>
+    static constexpr bool is_nothrow_storable =
+        call<T &, Bound...>::nothrow and
+        noexcept(std::declval<O &>() =
+                     each(std::declval<T &>(), std::declval<Bound &>()...));
+
+    template<class T, class... Bound>
+    static constexpr void for_each(std::span<T> in, Bound &...obj) noexcept(
+        call<T &, Bound...>::nothrow)
+    {
+        for (auto &elem : in)
+            each(elem, obj...);
+    }
+
+    template<class T, class O, class... Bound>
+    static constexpr void transform(std::span<T> in, std::span<O> out,
+                                    Bound &...obj) noexcept(
+        is_nothrow_storable<T, O, Bound...>)
+    {
+        assert(out.size() >= in.size() && "must have room for every result");
+        for (std::size_t i = 0; i != in.size(); ++i)
+            out[i] = each(in[i], obj...);
+    }
+
+  public:
+    template<class T>
+    constexpr void operator()(std::span<T> in) const
+        noexcept(call<T &>::nothrow)
+        requires call<T &>::invocable
+    {
+        for_each(in);
+    }
+
+    template<class T, class O>
+    constexpr void operator()(std::span<T> in, std::span<O> out) const
+        noexcept(is_nothrow_storable<T, O>)
+        requires is_storable<T, O>
+    {
+        transform(in, out);
+    }
+
+    template<class U, class T, class B = std::remove_reference_t<U>>
+    constexpr void operator()(U &&obj, std::span<T> in) const
+        noexcept(call<T &, B>::nothrow)
+        requires(not _is_span<std::remove_cvref_t<U>> and
+                 call<T &, B>::invocable)
+    {
+        for_each(in, obj);
+    }
+
+    template<class U, class T, class O, class B = std::remove_reference_t<U>>
+    constexpr void operator()(U &&obj, std::span<T> in,
+                              std::span<O> out) const
+        noexcept(is_nothrow_storable<T, O, B>)
+        requires(not _is_span<std::remove_cvref_t<U>> and
+                 is_storable<T, O, B>)
+    {
+        transform(in, out, obj);
+    }
+};
+
+template<auto f> inline constexpr batch_t<f> batch{};
+
+} // namespace std23
+
+#endif
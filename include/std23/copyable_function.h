@@ -0,0 +1,293 @@
+#ifndef INCLUDE_STD23_COPYABLE__FUNCTION
+#define INCLUDE_STD23_COPYABLE__FUNCTION
+
+#include "move_only_function.h"
+
+namespace std23
+{
+
+// Extends the vtables of move_only_function with an operation that copies
+// the target.  The call thunks and the other operations are shared with
+// move_only_function of the same signature.
+template<bool noex, class R, class... Args> struct _copyable_trait
+{
+    using base = _callable_trait<noex, R, Args...>;
+    using handle = base::handle;
+    using call_t = base::call_t;
+
+    typedef auto copy_t(handle, void *) -> handle;
+
+    struct vtable
+    {
+        typename base::vtable const *target;
+        copy_t *copy = nullptr; // null if the handle is the target
+    };
+
+    static inline constinit vtable const abstract_base{&base::abstract_base};
+
+    // Keeps a copy of the call thunk so that calling loads it from the
+    // wrapper rather than through the vtable
+    class vtable_ref
+    {
+        vtable const *vt_;
+
+      public:
+        call_t *call;
+
+        constexpr vtable_ref(vtable const &vt) noexcept
+            : vt_(std::addressof(vt)), call(vt.target->call)
+        {}
+
+        constexpr _move_only_ops const &ops() const noexcept
+        {
+            return vt_->target->ops;
+        }
+
+        constexpr copy_t *copy() const noexcept { return vt_->copy; }
+    };
+
+    template<class T, class Storage>
+    static constexpr auto copy_target = []() -> copy_t *
+    {
+        if constexpr (std::is_lvalue_reference_v<T> or std::is_pointer_v<T>)
+            return nullptr;
+        else if constexpr (std::is_same_v<Storage, _inline_storage>)
+            return [](handle from, void *to) -> handle
+            { return handle(::new (to) T(*Storage::template get<T>(from))); };
+        else
+            return [](handle from, void *) -> handle
+            { return handle(new T(*Storage::template get<T>(from))); };
+    }();
+
+    template<class T, template<class> class quals, class Storage>
+    static inline constinit vtable const callable_target{
+        .target = &base::template callable_target<T, quals, Storage>,
+        .copy = copy_target<T, Storage>,
+    };
+
+    template<auto f>
+    static inline constinit vtable const unbound_callable_target{
+        .target = &base::template unbound_callable_target<f>,
+    };
+
+    template<auto f, class T, template<class> class quals, class Storage>
+    static inline constinit vtable const bound_callable_target{
+        .target = &base::template bound_callable_target<f, T, quals, Storage>,
+        .copy = copy_target<T, Storage>,
+    };
+};
+
+template<class S, class = typename _full_fn_sig<S>::function>
+class copyable_function;
+
+// Dispatches through tables of function pointers shared by every wrapper of
+// a target type, rather than through virtual functions.  The call thunk is
+// kept in the wrapper, so an empty copyable_function is one whose thunk is
+// null.
+template<class S, class R, class... Args>
+class copyable_function<S, R(Args...)>
+    : public _owning_function_base<copyable_function<S, R(Args...)>, S>
+{
+    using signature = _full_fn_sig<S>;
+
+    template<class T> using cv = signature::template cv<T>;
+    template<class T> using ref = signature::template ref<T>;
+
+    static constexpr bool noex = signature::is_noexcept;
+    static constexpr bool is_lvalue_only = std::is_same_v<ref<int>, int &>;
+    static constexpr bool is_rvalue_only = std::is_same_v<ref<int>, int &&>;
+
+    template<class T> using cvref = ref<cv<T>>;
+    template<class T>
+    struct inv_quals_f
+        : std::conditional<is_lvalue_only or is_rvalue_only, cvref<T>, cv<T> &>
+    {};
+    template<class T> using inv_quals = inv_quals_f<T>::type;
+
+    template<class... T>
+    static constexpr bool is_invocable_using =
+        std::conditional_t<noex, std::is_nothrow_invocable_r<R, T..., Args...>,
+                           std::is_invocable_r<R, T..., Args...>>::value;
+
+    template<class VT>
+    static constexpr bool is_callable_from =
+        is_invocable_using<cvref<VT>> and is_invocable_using<inv_quals<VT>>;
+
+    template<auto f, class VT>
+    static constexpr bool is_callable_as_if_from =
+        is_invocable_using<decltype(f), inv_quals<VT>>;
+
+    using trait = _copyable_trait<noex, R, _param_t<Args>...>;
+
+    using buffer = _target_buffer<3 * sizeof(void *), alignof(void *)>;
+
+    typename trait::vtable_ref vtbl_ = trait::abstract_base;
+    _move_only_pointer obj_;
+    buffer buf_;
+
+    template<class T>
+    using storage_for =
+        std::conditional_t<buffer::is_stored_inline<T>, _inline_storage,
+                           _heap_storage>;
+
+    template<class T, class F>
+    static constexpr bool is_nothrow_taken = buffer::is_nothrow_taken<T, F>;
+
+    template<class T, class... Inits>
+    static constexpr bool is_nothrow_built =
+        buffer::is_nothrow_built<T, Inits...>;
+
+    template<class, class> friend class function_ref;
+    template<class, class, class> friend class _owning_function_base;
+
+    // Lets function_ref call the target without going through the wrapper
+    auto direct_call() const noexcept
+    {
+        return std::pair(vtbl_.call, obj_.val);
+    }
+
+    template<class, class> friend class move_only_function;
+
+    // Gives up the target, relocating an inline target to buf
+    auto release_into(void *buf) noexcept
+    {
+        auto vt = std::exchange(vtbl_, trait::abstract_base);
+        auto obj = std::exchange(obj_.val, {});
+        if (auto relocate = vt.ops().relocate)
+            obj = relocate(obj, buf);
+
+        return _released_target<typename trait::call_t>{
+            vt.call, std::addressof(vt.ops()), obj};
+    }
+
+  public:
+    using result_type = R;
+
+    copyable_function() = default;
+    copyable_function(nullptr_t) noexcept : copyable_function() {}
+
+    template<class F, class VT = std::decay_t<F>>
+    copyable_function(F &&f) noexcept(
+        is_nothrow_taken<std::unwrap_ref_decay_t<F>, F>)
+        requires _is_not_self<F, copyable_function> and
+                 _does_not_specialize<F, in_place_type_t> and
+                 is_callable_from<VT> and std::is_constructible_v<VT, F> and
+                 std::is_copy_constructible_v<VT>
+    {
+        if constexpr (_looks_nullable_to<F, copyable_function>)
+        {
+            if (f == nullptr)
+                return;
+        }
+
+        using T = std::unwrap_ref_decay_t<F>;
+        if constexpr (_is_stateless<T>)
+        {
+            vtbl_ = trait::template unbound_callable_target<
+                _stateless_call<T, inv_quals<T>>>;
+        }
+        else
+        {
+            vtbl_ = trait::template callable_target<T, inv_quals_f,
+                                                    storage_for<T>>;
+            obj_ = buffer::take_target<T>(buf_.bytes, std::forward<F>(f));
+        }
+    }
+
+    template<auto f>
+    copyable_function(nontype_t<f>) noexcept
+        requires is_invocable_using<decltype(f)>
+        : vtbl_(trait::template unbound_callable_target<f>)
+    {}
+
+    template<auto f, class T, class VT = std::decay_t<T>,
+             class U = std::unwrap_ref_decay_t<T>>
+    copyable_function(nontype_t<f>, T &&x) noexcept(is_nothrow_taken<U, T>)
+        requires is_callable_as_if_from<f, VT> and
+                     std::is_constructible_v<VT, T> and
+                     std::is_copy_constructible_v<VT>
+        : vtbl_(trait::template bound_callable_target<f, U, inv_quals_f,
+                                                      storage_for<U>>),
+          obj_(buffer::take_target<U>(buf_.bytes, std::forward<T>(x)))
+    {}
+
+    template<class T, class... Inits>
+    explicit copyable_function(in_place_type_t<T>, Inits &&...inits) noexcept(
+        is_nothrow_built<T, Inits...>)
+        requires is_callable_from<T> and
+                     std::is_constructible_v<T, Inits...> and
+                     std::is_copy_constructible_v<T>
+        : vtbl_(trait::template callable_target<std::unwrap_reference_t<T>,
+                                                inv_quals_f, storage_for<T>>),
+          obj_(buffer::build_target<T>(buf_.bytes,
+                                       std::forward<Inits>(inits)...))
+    {
+        static_assert(std::is_same_v<std::decay_t<T>, T>);
+    }
+
+    template<class T, class U, class... Inits>
+    explicit copyable_function(in_place_type_t<T>, initializer_list<U> ilist,
+                               Inits &&...inits) noexcept( //
+        is_nothrow_built<T, decltype((ilist)), Inits...>)
+        requires is_callable_from<T> and
+                     std::is_constructible_v<T, decltype((ilist)), Inits...> and
+                     std::is_copy_constructible_v<T>
+        : vtbl_(trait::template callable_target<std::unwrap_reference_t<T>,
+                                                inv_quals_f, storage_for<T>>),
+          obj_(buffer::build_target<T>(buf_.bytes, ilist,
+                                       std::forward<Inits>(inits)...))
+    {
+        static_assert(std::is_same_v<std::decay_t<T>, T>);
+    }
+
+    copyable_function(copyable_function const &other) : vtbl_(other.vtbl_)
+    {
+        if (auto copy = vtbl_.copy())
+            obj_.val = copy(other.obj_.val, buf_.bytes);
+        else
+            obj_.val = other.obj_.val;
+    }
+
+    copyable_function(copyable_function &&other) noexcept
+        : vtbl_(std::exchange(other.vtbl_, trait::abstract_base)),
+          obj_(std::move(other.obj_))
+    {
+        if (auto relocate = vtbl_.ops().relocate)
+            obj_.val = relocate(obj_.val, buf_.bytes);
+    }
+
+    copyable_function &operator=(copyable_function const &other)
+    {
+        if (&other != this)
+            copyable_function(other).swap(*this);
+
+        return *this;
+    }
+
+    copyable_function &operator=(copyable_function &&other) noexcept
+    {
+        if (&other != this)
+        {
+            std::destroy_at(this);
+            return *std::construct_at(this, std::move(other));
+        }
+        else
+            return *this;
+    }
+
+    void swap(copyable_function &other) noexcept
+    {
+        std::swap<copyable_function>(*this, other);
+    }
+
+    friend void swap(copyable_function &lhs, copyable_function &rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+    ~copyable_function() { vtbl_.ops().destroy(obj_.val); }
+};
+
+} // namespace std23
+
+#endif
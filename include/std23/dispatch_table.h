@@ -0,0 +1,99 @@
+#ifndef INCLUDE_STD23_DISPATCH__TABLE
+#define INCLUDE_STD23_DISPATCH__TABLE
+
+#include "function_ref.h"
+
+#include <array>
+#include <exception>
+#include <tuple>
+
+namespace std23
+{
+
+template<class Sig, class, auto... f> class _dispatch_table;
+
+// Calls the i-th of the NTTP callables f..., as function_ref<Sig> would
+// when constructed from nontype<f>.  The table holds the thunks that those
+// function_ref use, in static storage, so an empty dispatch_table may be
+// constinit.  With a handful of callables, the index is compared against
+// each in turn instead, which compilers turn into a switch and where each
+// callable can be inlined.  Either way, an index out of range calls
+// std::terminate.
+template<class Sig, auto... f>
+using dispatch_table =
+    _dispatch_table<Sig, typename _qual_fn_sig<Sig>::function, f...>;
+
+template<class Sig, class R, class... Args, auto... f>
+class _dispatch_table<Sig, R(Args...), f...>
+{
+    using target = function_ref<Sig>;
+    using fwd_t = target::fwd_t;
+    using storage = _function_ref_base::storage;
+
+    static constexpr bool noex = target::noex;
+    static constexpr std::size_t count = sizeof...(f);
+    static constexpr std::size_t switch_limit = 8;
+
+    static_assert(count != 0, "must have a callable to dispatch to");
+
+    static constexpr std::array<target, count> refs_ = {target(nontype<f>)...};
+
+    static constexpr auto table_ = []
+    {
+        std::array<fwd_t *, count> t{};
+        for (std::size_t i = 0; i != count; ++i)
+            t[i] = refs_[i].fptr_;
+
+        return t;
+    }();
+
+    template<std::size_t I>
+    static constexpr auto nth = std::get<I>(std::tuple(f...));
+
+    static constexpr void check(std::size_t i) noexcept
+    {
+        assert(i < count && "must refer to a callable");
+        if (i >= count) [[unlikely]]
+            std::terminate();
+    }
+
+    // Expects an index in range, so the last callable is the default
+    template<std::size_t I>
+    static constexpr R select(std::size_t i, Args &&...args) noexcept(noex)
+    {
+        if constexpr (I + 1 == count)
+            return std23::invoke_r<R>(nth<I>, std::forward<Args>(args)...);
+        else if (i == I)
+            return std23::invoke_r<R>(nth<I>, std::forward<Args>(args)...);
+        else
+            return select<I + 1>(i, std::forward<Args>(args)...);
+    }
+
+  public:
+    static constexpr std::size_t size() noexcept { return count; }
+
+    constexpr target operator[](std::size_t i) const noexcept
+    {
+        check(i);
+        return refs_[i];
+    }
+
+    constexpr R operator()(std::size_t i, Args... args) const noexcept(noex)
+    {
+        check(i);
+        if constexpr (count <= switch_limit)
+            return select<0>(i, std::forward<Args>(args)...);
+        else
+            return table_[i](storage(), std::forward<Args>(args)...);
+    }
+};
+
+template<class Sig, auto... f>
+constexpr dispatch_table<Sig, f...> make_dispatch_table(nontype_t<f>...)
+{
+    return {};
+}
+
+} // namespace std23
+
+#endif
@@ -3,6 +3,7 @@
 
 #include "__functional_base.h"
 
+#include <cstring>
 #include <memory>
 #include <new>
 
@@ -20,19 +21,76 @@ template<class R, class... Args> struct _opt_fn_sig<R(Args...)>
         std::is_invocable_r_v<R, T..., Args...>;
 };
 
+[[noreturn]] inline void _unreachable() noexcept
+{
+#if defined(_MSC_VER)
+    __assume(0);
+#else
+    __builtin_unreachable();
+#endif
+}
+
 template<class R, class... Args> struct _copyable_function
 {
+    using storage = _function_ref_base::storage;
+    typedef R call_t(storage, Args...);
+    using direct_call_t = std::pair<call_t *, storage>;
+    using released_t = _released_target<call_t>;
+
+    // For targets that are not owned or not stored
+    static inline constinit _move_only_ops const unowned_ops;
+
+    static constexpr std::size_t inline_size = 3 * sizeof(void *);
+
+    template<class T>
+    static constexpr bool is_stored_inline =
+        _is_inline_storable<T, inline_size, alignof(void *)>;
+
+    // The wrapper is relocated with memcpy unless its target is stored
+    // inline and says otherwise
+    template<class T>
+    static constexpr bool is_relocated_bitwise =
+        not is_stored_inline<T> or is_trivially_relocatable_v<T>;
+
+    template<class T>
+    static constexpr bool is_boxed = std::is_object_v<T> and
+                                     not std::is_pointer_v<T> and
+                                     not is_stored_inline<T>;
+
+    // Only boxed targets make use of an allocator
+    template<class T, class Alloc> struct allocator_for
+    {
+        using type = void;
+    };
+
+    template<class T, class Alloc> requires is_boxed<T>
+    struct allocator_for<T, Alloc>
+    {
+        using type = std::allocator_traits<Alloc>::template rebind_alloc<T>;
+    };
+
     struct lvalue_callable
     {
         virtual R operator()(Args...) const = 0;
         virtual constexpr ~lvalue_callable() = default;
 
+        // A thunk and an object that call the target without this class
+        virtual direct_call_t direct_call() const noexcept = 0;
+
+        // Moves the target out to be owned by a move_only_function, into buf
+        // if it is stored inline.  The caller reuses the storage of this
+        // object without destroying it.
+        virtual released_t release_into(void *buf) noexcept = 0;
+
+        // Moves the target into location, and leaves this storage to be
+        // reused without destroying it.  Does nothing and returns false if
+        // the caller may copy the bytes of the wrapper instead.
+        virtual bool relocate_into(void *) noexcept { return false; }
+
         void copy_into(std::byte *storage) const { copy_into_(storage); }
-        void move_into(std::byte *storage) noexcept { move_into_(storage); }
 
       protected:
         virtual void copy_into_(void *) const = 0;
-        virtual void move_into_(void *) noexcept = 0;
     };
 
     template<class Self> struct empty_object : lvalue_callable
@@ -41,58 +99,124 @@ template<class R, class... Args> struct _copyable_function
         {
             ::new (location) Self;
         }
-
-        void move_into_(void *location) noexcept override
-        {
-            ::new (location) Self;
-        }
     };
 
     struct constructible_lvalue : lvalue_callable
     {
-        [[noreturn]] R operator()(Args...) const override
+        [[noreturn]] R operator()(Args...) const override { _unreachable(); }
+
+        [[noreturn]] direct_call_t direct_call() const noexcept override
         {
-#if defined(_MSC_VER)
-            __assume(0);
-#else
-            __builtin_unreachable();
-#endif
+            _unreachable();
+        }
+
+        [[noreturn]] released_t release_into(void *) noexcept override
+        {
+            _unreachable();
         }
     };
 
     template<class T, class Self> class stored_object : constructible_lvalue
     {
-        std::conditional_t<std::is_pointer_v<T>, T, std::unique_ptr<T>> p_;
+        std::conditional_t<is_boxed<T>, std::unique_ptr<T>, T> obj_;
 
       public:
         template<class F>
         explicit stored_object(F &&f)
-            requires(_is_not_self<F, stored_object> and
-                     not std::is_pointer_v<T>)
-            : p_(std::make_unique<T>(std::forward<F>(f)))
+            requires(_is_not_self<F, stored_object> and is_boxed<T>)
+            : obj_(std::make_unique<T>(std::forward<F>(f)))
+        {}
+
+        template<class F>
+        explicit stored_object(F &&f) noexcept(
+            std::is_nothrow_constructible_v<T, F>)
+            requires(_is_not_self<F, stored_object> and is_stored_inline<T>)
+            : obj_(std::forward<F>(f))
         {}
 
         explicit stored_object(T p) noexcept requires std::is_pointer_v<T>
-            : p_(p)
+            : obj_(p)
+        {}
+
+        template<class A, class F>
+        stored_object(std::allocator_arg_t, A const &, F &&f)
+            : stored_object(std::forward<F>(f))
         {}
 
       protected:
+        static constexpr bool relocates_bitwise = is_relocated_bitwise<T>;
+
         decltype(auto) get() const
         {
             if constexpr (std::is_pointer_v<T>)
-                return p_;
+                return obj_;
+            else if constexpr (is_boxed<T>)
+                return *obj_;
             else
-                return *p_;
+                return const_cast<T &>(obj_);
         }
 
-        void copy_into_(void *location) const override
+        storage address() const noexcept
         {
-            ::new (location) Self(get());
+            if constexpr (std::is_pointer_v<T>)
+                return storage(obj_);
+            else
+                return storage(std::addressof(get()));
+        }
+
+        static decltype(auto) deref(storage obj) noexcept
+        {
+            if constexpr (std::is_pointer_v<T>)
+                return _function_ref_base::get<std::remove_pointer_t<T>>(obj);
+            else
+                return *_function_ref_base::get<T>(obj);
+        }
+
+        static inline constinit _move_only_ops const released_ops = []
+        {
+            if constexpr (std::is_pointer_v<T>)
+                return _move_only_ops{};
+            else if constexpr (is_boxed<T>)
+                return _move_only_ops{
+                    .destroy = [](storage obj) noexcept
+                    { delete _function_ref_base::get<T>(obj); },
+                };
+            else
+                return _move_only_ops{
+                    .destroy = [](storage obj) noexcept
+                    { std::destroy_at(_function_ref_base::get<T>(obj)); },
+                    .relocate = [](storage obj, void *to) noexcept
+                    {
+                        auto p = _function_ref_base::get<T>(obj);
+                        if constexpr (is_trivially_relocatable_v<T>)
+                        {
+                            std::memcpy(to, p, sizeof(T));
+                            return storage(
+                                std::launder(static_cast<T *>(to)));
+                        }
+                        else
+                        {
+                            auto q = ::new (to) T(std::move(*p));
+                            std::destroy_at(p);
+                            return storage(q);
+                        }
+                    },
+                };
+        }();
+
+        storage release(void *buf) noexcept
+        {
+            if constexpr (std::is_pointer_v<T>)
+                return storage(obj_);
+            else if constexpr (is_boxed<T>)
+                return storage(obj_.release());
+            else
+                return released_ops.relocate(address(), buf);
         }
 
-        void move_into_(void *location) noexcept override
+        void copy_into_(void *location) const override
         {
-            ::new (location) Self(std::move(*this));
+            ::new (location) Self(get());
         }
     };
 
@@ -104,26 +228,133 @@ template<class R, class... Args> struct _copyable_function
       public:
         explicit stored_object(T &target) noexcept : target_(target) {}
 
+        template<class A>
+        stored_object(std::allocator_arg_t, A const &, T &target) noexcept
+            : target_(target)
+        {}
+
       protected:
+        static constexpr bool relocates_bitwise = true;
+
         decltype(auto) get() const { return target_; }
 
+        storage address() const noexcept
+        {
+            return storage(std::addressof(target_));
+        }
+
+        static T &deref(storage obj) noexcept
+        {
+            return *_function_ref_base::get<T>(obj);
+        }
+
+        static constexpr auto &released_ops = unowned_ops;
+
+        storage release(void *) noexcept { return address(); }
+
         void copy_into_(void *location) const override
         {
             ::new (location) Self(*this);
         }
+    };
 
-        void move_into_(void *location) noexcept override
+    template<class T, class Self, class Alloc>
+    class allocated_object : constructible_lvalue
+    {
+        // Keeps the allocator out of the wrapper, which stays trivially
+        // relocatable whatever the allocator is
+        struct box
         {
-            ::new (location) Self(*this);
+            T obj;
+            [[no_unique_address]] Alloc alloc;
+
+            template<class F>
+            box(Alloc const &a, F &&f) : obj(std::forward<F>(f)), alloc(a)
+            {}
+        };
+
+        using allocator_type =
+            std::allocator_traits<Alloc>::template rebind_alloc<box>;
+        using traits = std::allocator_traits<allocator_type>;
+
+        box *p_;
+
+      public:
+        template<class F>
+        allocated_object(std::allocator_arg_t, Alloc const &a, F &&f)
+        {
+            allocator_type alloc(a);
+            p_ = traits::allocate(alloc, 1);
+            try
+            {
+                std::construct_at(p_, a, std::forward<F>(f));
+            }
+            catch (...)
+            {
+                traits::deallocate(alloc, p_, 1);
+                throw;
+            }
+        }
+
+        ~allocated_object() { dispose(p_); }
+
+      protected:
+        static constexpr bool relocates_bitwise = true;
+
+        static void dispose(box *p) noexcept
+        {
+            allocator_type alloc(std::move(p->alloc));
+            std::destroy_at(p);
+            traits::deallocate(alloc, p, 1);
+        }
+
+        T &get() const { return p_->obj; }
+
+        // Refers to the box, which carries the allocator along when the
+        // target is released
+        storage address() const noexcept { return storage(p_); }
+
+        static T &deref(storage obj) noexcept
+        {
+            return _function_ref_base::get<box>(obj)->obj;
+        }
+
+        static inline constinit _move_only_ops const released_ops{
+            .destroy = [](storage obj) noexcept
+            { dispose(_function_ref_base::get<box>(obj)); },
+        };
+
+        storage release(void *) noexcept { return address(); }
+
+        void copy_into_(void *location) const override
+        {
+            ::new (location) Self(std::allocator_arg, p_->alloc, get());
         }
     };
 
+    template<class T, class Self, class Alloc>
+    using object_base =
+        std::conditional_t<std::is_void_v<Alloc>, stored_object<T, Self>,
+                           allocated_object<T, Self, Alloc>>;
+
     struct empty_target_object final : empty_object<empty_target_object>
     {
         [[noreturn]] R operator()(Args...) const override
         {
             throw std::bad_function_call{};
         }
+
+        direct_call_t direct_call() const noexcept override
+        {
+            return {[](storage, Args...) -> R
+                    { throw std::bad_function_call{}; },
+                    {}};
+        }
+
+        released_t release_into(void *) noexcept override
+        {
+            return {nullptr, &unowned_ops, {}};
+        }
     };
 
     template<auto f>
@@ -133,12 +364,27 @@ template<class R, class... Args> struct _copyable_function
         {
             return std23::invoke_r<R>(f, static_cast<Args>(args)...);
         }
+
+        direct_call_t direct_call() const noexcept override
+        {
+            return {[](storage, Args... args) -> R {
+                        return std23::invoke_r<R>(f,
+                                                  static_cast<Args>(args)...);
+                    },
+                    {}};
+        }
+
+        released_t release_into(void *) noexcept override
+        {
+            return {direct_call().first, &unowned_ops, {}};
+        }
     };
 
-    template<class T>
-    class target_object final : stored_object<T, target_object<T>>
+    template<class T, class Alloc = void>
+    class target_object final
+        : object_base<T, target_object<T, Alloc>, Alloc>
     {
-        using base = stored_object<T, target_object<T>>;
+        using base = object_base<T, target_object, Alloc>;
 
       public:
         template<class F>
@@ -148,17 +394,49 @@ template<class R, class... Args> struct _copyable_function
             : base(std::forward<F>(f))
         {}
 
+        template<class A, class F>
+        target_object(std::allocator_arg_t t, A const &a, F &&f)
+            : base(t, a, std::forward<F>(f))
+        {}
+
         R operator()(Args... args) const override
         {
             return std23::invoke_r<R>(this->get(), static_cast<Args>(args)...);
         }
+
+        direct_call_t direct_call() const noexcept override
+        {
+            return {[](storage obj, Args... args) -> R {
+                        return std23::invoke_r<R>(base::deref(obj),
+                                                  static_cast<Args>(args)...);
+                    },
+                    this->address()};
+        }
+
+        released_t release_into(void *buf) noexcept override
+        {
+            return {direct_call().first, &base::released_ops,
+                    base::release(buf)};
+        }
+
+        bool relocate_into(void *location) noexcept override
+        {
+            if constexpr (base::relocates_bitwise)
+                return false;
+            else
+            {
+                ::new (location) target_object(std::move(*this));
+                std::destroy_at(this);
+                return true;
+            }
+        }
     };
 
-    template<auto f, class T>
+    template<auto f, class T, class Alloc = void>
     class bound_target_object final
-        : stored_object<T, bound_target_object<f, T>>
+        : object_base<T, bound_target_object<f, T, Alloc>, Alloc>
     {
-        using base = stored_object<T, bound_target_object<f, T>>;
+        using base = object_base<T, bound_target_object, Alloc>;
 
       public:
         template<class U>
@@ -168,11 +446,43 @@ template<class R, class... Args> struct _copyable_function
             : base(std::forward<U>(obj))
         {}
 
+        template<class A, class U>
+        bound_target_object(std::allocator_arg_t t, A const &a, U &&obj)
+            : base(t, a, std::forward<U>(obj))
+        {}
+
         R operator()(Args... args) const override
         {
             return std23::invoke_r<R>(f, this->get(),
                                       static_cast<Args>(args)...);
         }
+
+        direct_call_t direct_call() const noexcept override
+        {
+            return {[](storage obj, Args... args) -> R {
+                        return std23::invoke_r<R>(f, base::deref(obj),
+                                                  static_cast<Args>(args)...);
+                    },
+                    this->address()};
+        }
+
+        released_t release_into(void *buf) noexcept override
+        {
+            return {direct_call().first, &base::released_ops,
+                    base::release(buf)};
+        }
+
+        bool relocate_into(void *location) noexcept override
+        {
+            if constexpr (base::relocates_bitwise)
+                return false;
+            else
+            {
+                ::new (location) bound_target_object(std::move(*this));
+                std::destroy_at(this);
+                return true;
+            }
+        }
     };
 };
 
@@ -200,6 +510,7 @@ template<class S, class R, class... Args> class function<S, R(Args...)>
         {
             void (*fp)() = nullptr;
             void *p;
+            std::byte buf[copyable_function::inline_size];
         };
     };
 
@@ -207,6 +518,14 @@ template<class S, class R, class... Args> class function<S, R(Args...)>
     using target_object_for =
         copyable_function::template target_object<std::unwrap_ref_decay_t<F>>;
 
+    template<class T, class Alloc>
+    using allocator_for =
+        copyable_function::template allocator_for<T, Alloc>::type;
+
+    template<class F, class Alloc, class T = std::unwrap_ref_decay_t<F>>
+    using allocated_target_object_for =
+        copyable_function::template target_object<T, allocator_for<T, Alloc>>;
+
     template<auto f>
     using unbound_target_object =
         copyable_function::template unbound_target_object<f>;
@@ -216,6 +535,11 @@ template<class S, class R, class... Args> class function<S, R(Args...)>
         copyable_function::template bound_target_object<
             f, std::unwrap_ref_decay_t<T>>;
 
+    template<auto f, class U, class Alloc, class T = std::unwrap_ref_decay_t<U>>
+    using allocated_bound_target_object_for =
+        copyable_function::template bound_target_object<
+            f, T, allocator_for<T, Alloc>>;
+
     template<class F, class FD = std::decay_t<F>>
     static bool constexpr is_viable_initializer =
         std::is_copy_constructible_v<FD> and std::is_constructible_v<FD, F>;
@@ -236,6 +560,21 @@ template<class S, class R, class... Args> class function<S, R(Args...)>
             reinterpret_cast<lvalue_callable const *>(&storage_));
     }
 
+    template<class, class> friend class function_ref;
+
+    // Lets function_ref call the target without going through the wrapper
+    auto direct_call() const noexcept { return target()->direct_call(); }
+
+    template<class, class> friend class move_only_function;
+
+    // Hands the target over to a move_only_function
+    auto release_into(void *buf) noexcept
+    {
+        auto released = target()->release_into(buf);
+        ::new (storage_location()) empty_target_object;
+        return released;
+    }
+
   public:
     using result_type = R;
 
@@ -260,7 +599,11 @@ template<class S, class R, class... Args> class function<S, R(Args...)>
             }
         }
 
-        ::new (storage_location()) T(std::forward<F>(f));
+        if constexpr (_is_stateless<std::unwrap_ref_decay_t<F>>)
+            ::new (storage_location())
+                unbound_target_object<_stateless_call<std::decay_t<F>>>;
+        else
+            ::new (storage_location()) T(std::forward<F>(f));
     }
 
     template<auto f>
@@ -281,8 +624,50 @@ template<class S, class R, class... Args> class function<S, R(Args...)>
         ::new (storage_location()) T(std::forward<U>(obj));
     }
 
+    template<class Alloc, class F>
+    function(std::allocator_arg_t t, Alloc const &a, F &&f)
+        requires _is_not_self<F, function> and is_invocable_using<lvalue<F>> and
+                 is_viable_initializer<F>
+    {
+        using T = allocated_target_object_for<F, Alloc>;
+        static_assert(sizeof(T) <= sizeof(storage_));
+
+        if constexpr (_looks_nullable_to<F, function>)
+        {
+            if (f == nullptr)
+            {
+                std::construct_at(this);
+                return;
+            }
+        }
+
+        if constexpr (_is_stateless<std::unwrap_ref_decay_t<F>>)
+            ::new (storage_location())
+                unbound_target_object<_stateless_call<std::decay_t<F>>>;
+        else
+            ::new (storage_location()) T(t, a, std::forward<F>(f));
+    }
+
+    template<class Alloc, auto f, class U>
+    function(std::allocator_arg_t t, Alloc const &a, nontype_t<f>, U &&obj)
+        requires is_invocable_using<decltype(f), lvalue<U>> and
+                 is_viable_initializer<U>
+    {
+        using T = allocated_bound_target_object_for<f, U, Alloc>;
+        static_assert(sizeof(T) <= sizeof(storage_));
+
+        ::new (storage_location()) T(t, a, std::forward<U>(obj));
+    }
+
     function(function const &other) { other.target()->copy_into(storage_); }
-    function(function &&other) noexcept { other.target()->move_into(storage_); }
+
+    // Most targets are trivially relocatable
+    function(function &&other) noexcept
+    {
+        if (not other.target()->relocate_into(storage_location()))
+            std::memcpy(storage_, other.storage_, sizeof(storage_));
+        ::new (other.storage_location()) empty_target_object;
+    }
 
     function &operator=(function const &other)
     {
@@ -306,7 +691,13 @@ template<class S, class R, class... Args> class function<S, R(Args...)>
             return *this;
     }
 
-    void swap(function &other) noexcept { std::swap<function>(*this, other); }
+    void swap(function &other) noexcept
+    {
+        auto tmp = std::move(other);
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
     friend void swap(function &lhs, function &rhs) noexcept { lhs.swap(rhs); }
 
     ~function() { std::destroy_at(target()); }
@@ -47,41 +47,6 @@ struct _qual_fn_sig<R(Args...) const noexcept>
     template<class T> using cv = T const;
 };
 
-struct _function_ref_base
-{
-    union storage
-    {
-        void *p_ = nullptr;
-        void const *cp_;
-        void (*fp_)();
-
-        constexpr storage() noexcept = default;
-
-        template<class T> requires std::is_object_v<T>
-        constexpr explicit storage(T *p) noexcept : p_(p)
-        {}
-
-        template<class T> requires std::is_object_v<T>
-        constexpr explicit storage(T const *p) noexcept : cp_(p)
-        {}
-
-        template<class T> requires std::is_function_v<T>
-        constexpr explicit storage(T *p) noexcept
-            : fp_(reinterpret_cast<decltype(fp_)>(p))
-        {}
-    };
-
-    template<class T> constexpr static auto get(storage obj)
-    {
-        if constexpr (std::is_const_v<T>)
-            return static_cast<T *>(obj.cp_);
-        else if constexpr (std::is_object_v<T>)
-            return static_cast<T *>(obj.p_);
-        else
-            return reinterpret_cast<T *>(obj.fp_);
-    }
-};
-
 template<class Sig, class = typename _qual_fn_sig<Sig>::function>
 class function_ref; // freestanding
 
@@ -103,6 +68,21 @@ class function_ref<Sig, R(Args...)> // freestanding
     fwd_t *fptr_ = nullptr;
     storage obj_;
 
+    template<class, class> friend class function_ref;
+    template<class, class> friend class function_ref_vector;
+    template<class, class, auto...> friend class _dispatch_table;
+
+    template<class W>
+    static constexpr bool is_unwrappable = requires(W &w) {
+        requires std::is_convertible_v<decltype(w.direct_call().first),
+                                       fwd_t *>;
+    };
+
+    constexpr auto direct_call() const noexcept
+    {
+        return std::pair(fptr_, obj_);
+    }
+
   public:
     template<class F>
     function_ref(F *f) noexcept
@@ -137,6 +117,45 @@ class function_ref<Sig, R(Args...)> // freestanding
           obj_(std::addressof(f))
     {}
 
+    // Refers to the target of another wrapper rather than to the wrapper.
+    // The wrapper must outlive the function_ref, and must not be assigned,
+    // moved from, or swapped while the function_ref is in use, or the
+    // function_ref would call the old target's thunk on whatever the
+    // wrapper holds by then.
+    template<class W>
+    constexpr function_ref(W &w) noexcept
+        requires(_is_not_self<W, function_ref> and is_unwrappable<W> and
+                 is_invocable_using<cvref<W>>)
+    {
+        auto [call, obj] = w.direct_call();
+        fptr_ = call;
+        obj_ = obj;
+    }
+
+    // An unbound_function_ref refers to no object, so even a temporary one
+    // can hand over its function, which is then called through a thunk
+    template<class S, class F>
+    constexpr function_ref(unbound_function_ref<S, F> f) noexcept
+        requires is_unwrappable<unbound_function_ref<S, F>>
+    {
+        auto [call, obj] = f.direct_call();
+        fptr_ = call;
+        obj_ = obj;
+    }
+
+    // Dropping noexcept or const keeps the thunk callable as it is, so
+    // another function_ref of the same parameters is copied, not wrapped
+    template<class S>
+    constexpr function_ref(function_ref<S, R(Args...)> f) noexcept
+        requires(not std::is_same_v<S, Sig> and
+                 is_unwrappable<function_ref<S, R(Args...)>> and
+                 is_invocable_using<function_ref<S, R(Args...)> const &>)
+    {
+        auto [call, obj] = f.direct_call();
+        fptr_ = call;
+        obj_ = obj;
+    }
+
     template<class T>
     function_ref &operator=(T)
         requires(_is_not_self<T, function_ref> and not std::is_pointer_v<T> and
@@ -0,0 +1,102 @@
+#ifndef INCLUDE_STD23_FUNCTION__REF__VECTOR
+#define INCLUDE_STD23_FUNCTION__REF__VECTOR
+
+#include "function_ref.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace std23
+{
+
+template<class Sig, class = typename _qual_fn_sig<Sig>::function>
+class function_ref_vector;
+
+// A sequence of function_ref to be invoked together.  The objects are kept
+// in one array per thunk, so that invoke_all makes one predictable indirect
+// call per group, and appending never moves the objects of other groups.
+// The order of invocation is the order in which each group first appeared,
+// then the order of insertion within the group.
+template<class Sig, class R, class... Args>
+class function_ref_vector<Sig, R(Args...)>
+{
+    using storage = _function_ref_base::storage;
+    using fwd_t = function_ref<Sig>::fwd_t;
+
+    static constexpr bool noex = function_ref<Sig>::noex;
+
+    struct group
+    {
+        fwd_t *call;
+        std::vector<storage> objs;
+    };
+
+    std::vector<group> groups_;
+    std::size_t size_ = 0;
+    std::size_t reserved_ = 0; // capacity of a new group
+
+    template<class T>
+    static constexpr bool is_shareable =
+        std::is_lvalue_reference_v<T> or
+        (std::is_object_v<T> and std::is_copy_constructible_v<T>);
+
+  public:
+    using value_type = function_ref<Sig>;
+    using size_type = std::size_t;
+
+    function_ref_vector() = default;
+
+    // Searches only the distinct thunks, which are few
+    void push_back(function_ref<Sig> f)
+    {
+        auto it = std::find_if(groups_.begin(), groups_.end(),
+                               [&](group const &g)
+                               { return g.call == f.fptr_; });
+        if (it == groups_.end())
+        {
+            it = groups_.insert(it, group{f.fptr_, {}});
+            it->objs.reserve(reserved_);
+        }
+
+        it->objs.push_back(f.obj_);
+        ++size_;
+    }
+
+    // Makes room for n targets of each thunk
+    void reserve(size_type n)
+    {
+        reserved_ = std::max(reserved_, n);
+        for (auto &g : groups_)
+            g.objs.reserve(n);
+    }
+
+    void clear() noexcept
+    {
+        groups_.clear();
+        size_ = 0;
+    }
+
+    size_type size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    // Number of distinct thunks
+    size_type group_count() const noexcept { return groups_.size(); }
+
+    // Calls every target, discarding the results.  Each target receives
+    // its own copy of the arguments taken by value.
+    void invoke_all(Args... args) const
+        noexcept(noex and (std::is_nothrow_constructible_v<Args, Args &> and
+                           ...))
+        requires(is_shareable<Args> and ...)
+    {
+        for (auto &[call, objs] : groups_)
+        {
+            for (auto obj : objs)
+                call(obj, static_cast<_param_t<Args>>(Args(args))...);
+        }
+    }
+};
+
+} // namespace std23
+
+#endif
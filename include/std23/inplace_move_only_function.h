@@ -0,0 +1,237 @@
+#ifndef INCLUDE_STD23_INPLACE__MOVE__ONLY__FUNCTION
+#define INCLUDE_STD23_INPLACE__MOVE__ONLY__FUNCTION
+
+#include "move_only_function.h"
+
+#include <cstddef>
+
+namespace std23
+{
+
+template<class S, std::size_t Capacity = 3 * sizeof(void *),
+         std::size_t Align = alignof(std::max_align_t),
+         class = typename _full_fn_sig<S>::function>
+class inplace_move_only_function;
+
+template<class T>
+inline constexpr bool _is_inplace_move_only_function = false;
+
+template<class S, std::size_t Capacity, std::size_t Align>
+inline constexpr bool _is_inplace_move_only_function<
+    inplace_move_only_function<S, Capacity, Align>> = true;
+
+template<class S, std::size_t Capacity, std::size_t Align, class R,
+         class... Args>
+class inplace_move_only_function<S, Capacity, Align, R(Args...)>
+    : public _owning_function_base<
+          inplace_move_only_function<S, Capacity, Align, R(Args...)>, S>
+{
+    using signature = _full_fn_sig<S>;
+
+    template<class T> using cv = signature::template cv<T>;
+    template<class T> using ref = signature::template ref<T>;
+
+    static constexpr bool noex = signature::is_noexcept;
+    static constexpr bool is_lvalue_only = std::is_same_v<ref<int>, int &>;
+    static constexpr bool is_rvalue_only = std::is_same_v<ref<int>, int &&>;
+
+    template<class T> using cvref = ref<cv<T>>;
+    template<class T>
+    struct inv_quals_f
+        : std::conditional<is_lvalue_only or is_rvalue_only, cvref<T>, cv<T> &>
+    {};
+    template<class T> using inv_quals = inv_quals_f<T>::type;
+
+    template<class... T>
+    static constexpr bool is_invocable_using =
+        std::conditional_t<noex, std::is_nothrow_invocable_r<R, T..., Args...>,
+                           std::is_invocable_r<R, T..., Args...>>::value;
+
+    template<class VT>
+    static constexpr bool is_callable_from =
+        is_invocable_using<cvref<VT>> and is_invocable_using<inv_quals<VT>>;
+
+    template<auto f, class VT>
+    static constexpr bool is_callable_as_if_from =
+        is_invocable_using<decltype(f), inv_quals<VT>>;
+
+    // Pointers and reference_wrapper are held by the handle
+    template<class T>
+    static constexpr bool is_storable =
+        std::is_pointer_v<T> or std::is_lvalue_reference_v<T> or
+        _is_inline_storable<T, Capacity, Align>;
+
+    using buffer = _target_buffer<Capacity, Align>;
+
+    template<class T>
+    using storage_for =
+        std::conditional_t<buffer::template is_stored_inline<T>,
+                           _inline_storage, _heap_storage>;
+
+    template<class F>
+    static constexpr bool looks_nullable =
+        _looks_nullable_to<F, move_only_function> or
+        _is_inplace_move_only_function<std::remove_cvref_t<F>>;
+
+    using trait = _callable_trait<noex, R, _param_t<Args>...>;
+    using vtable = trait::vtable;
+
+    typename trait::vtable_ref vtbl_ = trait::abstract_base;
+    _move_only_pointer obj_;
+    buffer buf_;
+
+    template<class, class> friend class function_ref;
+    template<class, class, class> friend class _owning_function_base;
+
+    // Lets function_ref call the target without going through the wrapper
+    auto direct_call() const noexcept
+    {
+        return std::pair(vtbl_.call, obj_.val);
+    }
+
+  public:
+    using result_type = R;
+
+    static constexpr std::size_t capacity = Capacity;
+    static constexpr std::size_t alignment = Align;
+
+    inplace_move_only_function() = default;
+    inplace_move_only_function(nullptr_t) noexcept
+        : inplace_move_only_function()
+    {}
+
+    template<class F, class VT = std::decay_t<F>,
+             class T = std::unwrap_ref_decay_t<F>>
+    inplace_move_only_function(F &&f) noexcept(
+        std::is_nothrow_constructible_v<VT, F>)
+        requires _is_not_self<F, inplace_move_only_function> and
+                 _does_not_specialize<F, in_place_type_t> and
+                 is_callable_from<VT> and std::is_constructible_v<VT, F> and
+                 is_storable<T>
+    {
+        if constexpr (looks_nullable<F>)
+        {
+            if (f == nullptr)
+                return;
+        }
+
+        vtbl_ = trait::template callable_target<T, inv_quals_f, storage_for<T>>;
+        obj_ = buffer::template take_target<T>(buf_.bytes, std::forward<F>(f));
+    }
+
+    template<auto f>
+    inplace_move_only_function(nontype_t<f>) noexcept
+        requires is_invocable_using<decltype(f)>
+        : vtbl_(trait::template unbound_callable_target<f>)
+    {}
+
+    template<auto f, class T, class VT = std::decay_t<T>,
+             class U = std::unwrap_ref_decay_t<T>>
+    inplace_move_only_function(nontype_t<f>, T &&x) noexcept(
+        std::is_nothrow_constructible_v<VT, T>)
+        requires is_callable_as_if_from<f, VT> and
+                     std::is_constructible_v<VT, T> and is_storable<U>
+        : vtbl_(trait::template bound_callable_target<f, U, inv_quals_f,
+                                                      storage_for<U>>),
+          obj_(buffer::template take_target<U>(buf_.bytes, std::forward<T>(x)))
+    {}
+
+    template<class T, class... Inits>
+    explicit inplace_move_only_function(in_place_type_t<T>,
+                                        Inits &&...inits) noexcept( //
+        std::is_nothrow_constructible_v<T, Inits...>)
+        requires is_callable_from<T> and
+                 std::is_constructible_v<T, Inits...> and
+                 is_storable<std::unwrap_reference_t<T>>
+        : vtbl_(trait::template callable_target<std::unwrap_reference_t<T>,
+                                                inv_quals_f, storage_for<T>>),
+          obj_(buffer::template build_target<T>(buf_.bytes,
+                                                std::forward<Inits>(inits)...))
+    {
+        static_assert(std::is_same_v<std::decay_t<T>, T>);
+    }
+
+    template<class T, class U, class... Inits>
+    explicit inplace_move_only_function(in_place_type_t<T>,
+                                        initializer_list<U> ilist,
+                                        Inits &&...inits) noexcept( //
+        std::is_nothrow_constructible_v<T, decltype((ilist)), Inits...>)
+        requires is_callable_from<T> and
+                 std::is_constructible_v<T, decltype((ilist)), Inits...> and
+                 is_storable<std::unwrap_reference_t<T>>
+        : vtbl_(trait::template callable_target<std::unwrap_reference_t<T>,
+                                                inv_quals_f, storage_for<T>>),
+          obj_(buffer::template build_target<T>(
+              buf_.bytes, ilist, std::forward<Inits>(inits)...))
+    {
+        static_assert(std::is_same_v<std::decay_t<T>, T>);
+    }
+
+    template<auto f, class T, class... Inits>
+    explicit inplace_move_only_function(nontype_t<f>, in_place_type_t<T>,
+                                        Inits &&...inits) noexcept( //
+        std::is_nothrow_constructible_v<T, Inits...>)
+        requires is_callable_as_if_from<f, T> and
+                 std::is_constructible_v<T, Inits...> and
+                 is_storable<std::unwrap_reference_t<T>>
+        : vtbl_(trait::template bound_callable_target<
+                f, std::unwrap_reference_t<T>, inv_quals_f, storage_for<T>>),
+          obj_(buffer::template build_target<T>(buf_.bytes,
+                                                std::forward<Inits>(inits)...))
+    {
+        static_assert(std::is_same_v<std::decay_t<T>, T>);
+    }
+
+    template<auto f, class T, class U, class... Inits>
+    explicit inplace_move_only_function(nontype_t<f>, in_place_type_t<T>,
+                                        initializer_list<U> ilist,
+                                        Inits &&...inits) noexcept( //
+        std::is_nothrow_constructible_v<T, decltype((ilist)), Inits...>)
+        requires is_callable_as_if_from<f, T> and
+                 std::is_constructible_v<T, decltype((ilist)), Inits...> and
+                 is_storable<std::unwrap_reference_t<T>>
+        : vtbl_(trait::template bound_callable_target<
+                f, std::unwrap_reference_t<T>, inv_quals_f, storage_for<T>>),
+          obj_(buffer::template build_target<T>(
+              buf_.bytes, ilist, std::forward<Inits>(inits)...))
+    {
+        static_assert(std::is_same_v<std::decay_t<T>, T>);
+    }
+
+    inplace_move_only_function(inplace_move_only_function &&other) noexcept
+        : vtbl_(std::exchange(other.vtbl_, trait::abstract_base)),
+          obj_(std::move(other.obj_))
+    {
+        if (auto relocate = vtbl_.get().relocate)
+            obj_.val = relocate(obj_.val, buf_.bytes);
+    }
+
+    inplace_move_only_function &
+    operator=(inplace_move_only_function &&other) noexcept
+    {
+        if (&other != this)
+        {
+            std::destroy_at(this);
+            return *std::construct_at(this, std::move(other));
+        }
+        else
+            return *this;
+    }
+
+    void swap(inplace_move_only_function &other) noexcept
+    {
+        std::swap<inplace_move_only_function>(*this, other);
+    }
+
+    friend void swap(inplace_move_only_function &lhs,
+                     inplace_move_only_function &rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+    ~inplace_move_only_function() { vtbl_.get().destroy(obj_.val); }
+};
+
+} // namespace std23
+
+#endif
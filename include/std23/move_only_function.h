@@ -3,6 +3,7 @@
 
 #include "__functional_base.h"
 
+#include <cstring>
 #include <memory>
 #include <new>
 #include <utility>
@@ -10,126 +11,10 @@
 namespace std23
 {
 
-template<class Sig> struct _cv_fn_sig
-{};
-
-template<class R, class... Args> struct _cv_fn_sig<R(Args...)>
-{
-    using function = R(Args...);
-    template<class T> using cv = T;
-};
-
-template<class R, class... Args> struct _cv_fn_sig<R(Args...) const>
-{
-    using function = R(Args...);
-    template<class T> using cv = T const;
-};
-
-template<class Sig> struct _ref_quals_fn_sig : _cv_fn_sig<Sig>
-{
-    template<class T> using ref = T;
-};
-
-template<class R, class... Args>
-struct _ref_quals_fn_sig<R(Args...) &> : _cv_fn_sig<R(Args...)>
-{
-    template<class T> using ref = T &;
-};
-
-template<class R, class... Args>
-struct _ref_quals_fn_sig<R(Args...) const &> : _cv_fn_sig<R(Args...) const>
-{
-    template<class T> using ref = T &;
-};
-
-template<class R, class... Args>
-struct _ref_quals_fn_sig<R(Args...) &&> : _cv_fn_sig<R(Args...)>
-{
-    template<class T> using ref = T &&;
-};
-
-template<class R, class... Args>
-struct _ref_quals_fn_sig<R(Args...) const &&> : _cv_fn_sig<R(Args...) const>
-{
-    template<class T> using ref = T &&;
-};
-
-template<bool V> struct _noex_traits
-{
-    static constexpr bool is_noexcept = V;
-};
-
-template<class Sig>
-struct _full_fn_sig : _ref_quals_fn_sig<Sig>, _noex_traits<false>
-{};
-
-template<class R, class... Args>
-struct _full_fn_sig<R(Args...) noexcept> : _ref_quals_fn_sig<R(Args...)>,
-                                           _noex_traits<true>
-{};
-
-template<class R, class... Args>
-struct _full_fn_sig<R(Args...) & noexcept> : _ref_quals_fn_sig<R(Args...) &>,
-                                             _noex_traits<true>
-{};
-
-template<class R, class... Args>
-struct _full_fn_sig<R(Args...) && noexcept> : _ref_quals_fn_sig<R(Args...) &&>,
-                                              _noex_traits<true>
-{};
-
-template<class R, class... Args>
-struct _full_fn_sig<R(Args...) const noexcept>
-    : _ref_quals_fn_sig<R(Args...) const>, _noex_traits<true>
-{};
-
-template<class R, class... Args>
-struct _full_fn_sig<R(Args...) const & noexcept>
-    : _ref_quals_fn_sig<R(Args...) const &>, _noex_traits<true>
-{};
-
-template<class R, class... Args>
-struct _full_fn_sig<R(Args...) const && noexcept>
-    : _ref_quals_fn_sig<R(Args...) const &&>, _noex_traits<true>
-{};
-
-constexpr inline struct
-{
-    constexpr auto operator()(auto &&rhs) const
-    {
-        return new auto(decltype(rhs)(rhs));
-    }
-
-    constexpr auto operator()(auto *rhs) const noexcept { return rhs; }
-
-    template<class T>
-    constexpr auto operator()(std::reference_wrapper<T> rhs) const noexcept
-    {
-        return std::addressof(rhs.get());
-    }
-
-} _take_reference;
-
-template<class T>
-constexpr auto _build_reference = [](auto &&...args)
-{ return new T(decltype(args)(args)...); };
-
-template<class T>
-constexpr auto _build_reference<T *> = [](auto &&...args) noexcept -> T *
-{ return {decltype(args)(args)...}; };
-
-template<class T>
-constexpr auto _build_reference<std::reference_wrapper<T>> =
-    [](auto &rhs) noexcept { return std::addressof(rhs); };
-
 struct _move_only_pointer
 {
-    union value_type
-    {
-        void *p_ = nullptr;
-        void const *cp_;
-        void (*fp_)();
-    } val;
+    using value_type = _function_ref_base::storage;
+    value_type val;
 
     _move_only_pointer() = default;
     _move_only_pointer(_move_only_pointer const &) = delete;
@@ -140,16 +25,15 @@ struct _move_only_pointer
     {}
 
     template<class T> requires std::is_object_v<T>
-    constexpr explicit _move_only_pointer(T *p) noexcept : val{.p_ = p}
+    constexpr explicit _move_only_pointer(T *p) noexcept : val(p)
     {}
 
     template<class T> requires std::is_object_v<T>
-    constexpr explicit _move_only_pointer(T const *p) noexcept : val{.cp_ = p}
+    constexpr explicit _move_only_pointer(T const *p) noexcept : val(p)
     {}
 
     template<class T> requires std::is_function_v<T>
-    constexpr explicit _move_only_pointer(T *p) noexcept
-        : val{.fp_ = reinterpret_cast<decltype(val.fp_)>(p)}
+    constexpr explicit _move_only_pointer(T *p) noexcept : val(p)
     {}
 
     template<class T> requires std::is_object_v<T>
@@ -180,21 +64,139 @@ struct _move_only_pointer
     }
 };
 
+struct _heap_storage
+{
+    using handle = _move_only_pointer::value_type;
+
+    template<class T> static T *get(handle this_) noexcept
+    {
+        return static_cast<T *>(this_.p_);
+    }
+
+    template<class T> static void destroy(handle this_) noexcept
+    {
+        delete get<T>(this_);
+    }
+
+    template<class T> static constexpr nullptr_t relocate = nullptr;
+};
+
+struct _inline_storage : _heap_storage
+{
+    template<class T> static void destroy(handle this_) noexcept
+    {
+        std::destroy_at(get<T>(this_));
+    }
+
+    template<class T>
+    static constexpr auto relocate = [](handle this_, void *to) noexcept
+    {
+        auto p = get<T>(this_);
+        if constexpr (is_trivially_relocatable_v<T>)
+        {
+            std::memcpy(to, p, sizeof(T));
+            return handle(std::launder(static_cast<T *>(to)));
+        }
+        else
+        {
+            auto q = ::new (to) T(std::move(*p));
+            std::destroy_at(p);
+            return handle(q);
+        }
+    };
+};
+
+template<class Alloc> struct _allocated_storage
+{
+    using handle = _move_only_pointer::value_type;
+
+    template<class T> struct box
+    {
+        using allocator_type =
+            std::allocator_traits<Alloc>::template rebind_alloc<box>;
+
+        T obj;
+        [[no_unique_address]] allocator_type alloc;
+
+        template<class... Inits>
+        explicit box(Alloc const &a, Inits &&...inits)
+            : obj(std::forward<Inits>(inits)...), alloc(a)
+        {}
+    };
+
+    template<class T> static T *get(handle this_) noexcept
+    {
+        return std::addressof(static_cast<box<T> *>(this_.p_)->obj);
+    }
+
+    template<class T, class... Inits>
+    static auto make(Alloc const &a, Inits &&...inits) -> box<T> *
+    {
+        using A = box<T>::allocator_type;
+        using traits = std::allocator_traits<A>;
+
+        A alloc(a);
+        auto p = traits::allocate(alloc, 1);
+        try
+        {
+            return std::construct_at(std::to_address(p), a,
+                                     std::forward<Inits>(inits)...);
+        }
+        catch (...)
+        {
+            traits::deallocate(alloc, p, 1);
+            throw;
+        }
+    }
+
+    template<class T> static void destroy(handle this_) noexcept
+    {
+        using A = box<T>::allocator_type;
+
+        auto p = static_cast<box<T> *>(this_.p_);
+        A alloc(std::move(p->alloc));
+        std::destroy_at(p);
+        std::allocator_traits<A>::deallocate(alloc, p, 1);
+    }
+
+    template<class T> static constexpr nullptr_t relocate = nullptr;
+};
+
 template<bool noex, class R, class... Args> struct _callable_trait
 {
     using handle = _move_only_pointer::value_type;
 
     typedef auto call_t(handle, Args...) noexcept(noex) -> R;
-    typedef void destroy_t(handle) noexcept;
 
     struct vtable
     {
         call_t *call = 0;
-        destroy_t *destroy = [](handle) noexcept {};
+        _move_only_ops ops;
     };
 
     static inline constinit vtable const abstract_base;
 
+    // Keeps a copy of the call thunk so that calling loads it from the
+    // wrapper rather than through the vtable
+    class vtable_ref
+    {
+        _move_only_ops const *ops_;
+
+      public:
+        call_t *call;
+
+        constexpr vtable_ref(vtable const &vt) noexcept
+            : ops_(std::addressof(vt.ops)), call(vt.call)
+        {}
+
+        // Rebinds to a target adopted from another wrapper
+        constexpr vtable_ref(call_t *f, _move_only_ops const &ops) noexcept
+            : ops_(std::addressof(ops)), call(f)
+        {}
+
+        constexpr _move_only_ops const &get() const noexcept { return *ops_; }
+    };
+
     template<class T> constexpr static auto get(handle val)
     {
         if constexpr (std::is_const_v<T>)
@@ -206,7 +208,8 @@ template<bool noex, class R, class... Args> struct _callable_trait
     }
 
     // See also: https://gcc.gnu.org/bugzilla/show_bug.cgi?id=71954
-    template<class T, template<class> class quals>
+    template<class T, template<class> class quals,
+             class Storage = _heap_storage>
     static inline constinit vtable const callable_target{
         .call = [](handle this_, Args... args) noexcept(noex) -> R
         {
@@ -219,17 +222,22 @@ template<bool noex, class R, class... Args> struct _callable_trait
             else
             {
                 using Fp = quals<T>::type;
-                return std23::invoke_r<R>(static_cast<Fp>(*get<T>(this_)),
-                                          static_cast<Args>(args)...);
+                return std23::invoke_r<R>(
+                    static_cast<Fp>(*Storage::template get<T>(this_)),
+                    static_cast<Args>(args)...);
             }
         },
-        .destroy =
-            [](handle this_) noexcept
-        {
-            if constexpr (not std::is_lvalue_reference_v<T> and
-                          not std::is_pointer_v<T>)
-                delete get<T>(this_);
-        },
+        .ops =
+            {
+                .destroy =
+                    [](handle this_) noexcept
+                {
+                    if constexpr (not std::is_lvalue_reference_v<T> and
+                                  not std::is_pointer_v<T>)
+                        Storage::template destroy<T>(this_);
+                },
+                .relocate = Storage::template relocate<T>,
+            },
     };
 
     template<auto f>
@@ -238,7 +246,8 @@ template<bool noex, class R, class... Args> struct _callable_trait
         { return std23::invoke_r<R>(f, static_cast<Args>(args)...); },
     };
 
-    template<auto f, class T, template<class> class quals>
+    template<auto f, class T, template<class> class quals,
+             class Storage = _heap_storage>
     static inline constinit vtable const bound_callable_target{
         .call = [](handle this_, Args... args) noexcept(noex) -> R
         {
@@ -257,17 +266,22 @@ template<bool noex, class R, class... Args> struct _callable_trait
             else
             {
                 using Fp = quals<T>::type;
-                return std23::invoke_r<R>(f, static_cast<Fp>(*get<T>(this_)),
-                                          static_cast<Args>(args)...);
+                return std23::invoke_r<R>(
+                    f, static_cast<Fp>(*Storage::template get<T>(this_)),
+                    static_cast<Args>(args)...);
             }
         },
-        .destroy =
-            [](handle this_) noexcept
-        {
-            if constexpr (not std::is_lvalue_reference_v<T> and
-                          not std::is_pointer_v<T>)
-                delete get<T>(this_);
-        },
+        .ops =
+            {
+                .destroy =
+                    [](handle this_) noexcept
+                {
+                    if constexpr (not std::is_lvalue_reference_v<T> and
+                                  not std::is_pointer_v<T>)
+                        Storage::template destroy<T>(this_);
+                },
+                .relocate = Storage::template relocate<T>,
+            },
     };
 
     template<auto f, class T>
@@ -276,14 +290,18 @@ template<bool noex, class R, class... Args> struct _callable_trait
             return std23::invoke_r<R>(f, get<T>(this_),
                                       static_cast<Args>(args)...);
         },
-        .destroy =
-            [](handle this_) noexcept
-        {
-            using D = std::unique_ptr<T>::deleter_type;
-            static_assert(std::is_trivially_default_constructible_v<D>);
-            if (auto p = get<T>(this_))
-                D()(p);
-        },
+        .ops =
+            {
+                .destroy =
+                    [](handle this_) noexcept
+                {
+                    using D = std::unique_ptr<T>::deleter_type;
+                    static_assert(
+                        std::is_trivially_default_constructible_v<D>);
+                    if (auto p = get<T>(this_))
+                        D()(p);
+                },
+            },
     };
 };
 
@@ -302,6 +320,7 @@ class move_only_function;
 
 template<class S, class R, class... Args>
 class move_only_function<S, R(Args...)>
+    : public _owning_function_base<move_only_function<S, R(Args...)>, S>
 {
     using signature = _full_fn_sig<S>;
 
@@ -309,7 +328,6 @@ class move_only_function<S, R(Args...)>
     template<class T> using ref = signature::template ref<T>;
 
     static constexpr bool noex = signature::is_noexcept;
-    static constexpr bool is_const = std::is_same_v<cv<void>, void const>;
     static constexpr bool is_lvalue_only = std::is_same_v<ref<int>, int &>;
     static constexpr bool is_rvalue_only = std::is_same_v<ref<int>, int &&>;
 
@@ -336,8 +354,94 @@ class move_only_function<S, R(Args...)>
     using trait = _callable_trait<noex, R, _param_t<Args>...>;
     using vtable = trait::vtable;
 
-    std::reference_wrapper<vtable const> vtbl_ = trait::abstract_base;
+    using buffer = _target_buffer<3 * sizeof(void *), alignof(void *)>;
+
+    typename trait::vtable_ref vtbl_ = trait::abstract_base;
     _move_only_pointer obj_;
+    buffer buf_;
+
+    template<class T>
+    static constexpr bool is_stored_inline = buffer::is_stored_inline<T>;
+
+    template<class T>
+    using storage_for =
+        std::conditional_t<is_stored_inline<T>, _inline_storage, _heap_storage>;
+
+    template<class T, class F>
+    static constexpr bool is_nothrow_taken = buffer::is_nothrow_taken<T, F>;
+
+    template<class T, class... Inits>
+    static constexpr bool is_nothrow_built =
+        buffer::is_nothrow_built<T, Inits...>;
+
+    template<class T>
+    static constexpr bool is_allocated = std::is_object_v<T> and
+                                         not std::is_pointer_v<T> and
+                                         not is_stored_inline<T>;
+
+    template<class T, class Alloc>
+    using allocated_storage_for =
+        std::conditional_t<is_allocated<T>, _allocated_storage<Alloc>,
+                           storage_for<T>>;
+
+    template<class T, class Alloc, class F>
+    auto take_target(std::allocator_arg_t, Alloc const &a, F &&f)
+    {
+        if constexpr (is_allocated<T>)
+            return _allocated_storage<Alloc>::template make<T>(
+                a, std::forward<F>(f));
+        else
+            return buffer::take_target<T>(buf_.bytes, std::forward<F>(f));
+    }
+
+    template<class T, class Alloc, class... Inits>
+    auto build_target(std::allocator_arg_t, Alloc const &a, Inits &&...inits)
+    {
+        if constexpr (is_allocated<std::unwrap_reference_t<T>>)
+            return _allocated_storage<Alloc>::template make<T>(
+                a, std::forward<Inits>(inits)...);
+        else
+            return buffer::build_target<T>(buf_.bytes,
+                                           std::forward<Inits>(inits)...);
+    }
+
+    template<class, class> friend class function_ref;
+    template<class, class, class> friend class _owning_function_base;
+
+    // Lets function_ref call the target without going through the wrapper
+    auto direct_call() const noexcept
+    {
+        return std::pair(vtbl_.call, obj_.val);
+    }
+
+    template<class, class> friend class move_only_function;
+
+    // Gives up the target, relocating an inline target to buf
+    auto release_into(void *buf) noexcept
+    {
+        auto vt = std::exchange(vtbl_, trait::abstract_base);
+        auto obj = std::exchange(obj_.val, {});
+        if (auto relocate = vt.get().relocate)
+            obj = relocate(obj, buf);
+
+        return _released_target<typename trait::call_t>{
+            vt.call, std::addressof(vt.get()), obj};
+    }
+
+    // Whether a wrapper of another signature can hand over its target along
+    // with its call thunk, keeping a single indirection per call
+    template<class W>
+    static constexpr bool is_adoptable =
+        requires(W &w, void *buf) {
+            requires std::is_convertible_v<decltype(w.release_into(buf).call),
+                                           typename trait::call_t *>;
+        } and is_callable_from<W>;
+
+    template<class Call> void adopt(_released_target<Call> target) noexcept
+    {
+        vtbl_ = {target.call, *target.ops};
+        obj_.val = target.obj;
+    }
 
   public:
     using result_type = R;
@@ -347,7 +451,7 @@ class move_only_function<S, R(Args...)>
 
     template<class F, class VT = std::decay_t<F>>
     move_only_function(F &&f) noexcept(
-        std::is_nothrow_invocable_v<decltype(_take_reference), F>)
+        is_nothrow_taken<std::unwrap_ref_decay_t<F>, F>)
         requires _is_not_self<F, move_only_function> and
                  _does_not_specialize<F, in_place_type_t> and
                  is_callable_from<VT> and std::is_constructible_v<VT, F>
@@ -358,9 +462,18 @@ class move_only_function<S, R(Args...)>
                 return;
         }
 
-        vtbl_ = trait::template callable_target<std::unwrap_ref_decay_t<F>,
-                                                inv_quals_f>;
-        obj_ = _take_reference(std::forward<F>(f));
+        using T = std::unwrap_ref_decay_t<F>;
+        if constexpr (_is_stateless<T>)
+        {
+            vtbl_ = trait::template unbound_callable_target<
+                _stateless_call<T, inv_quals<T>>>;
+        }
+        else
+        {
+            vtbl_ = trait::template callable_target<T, inv_quals_f,
+                                                    storage_for<T>>;
+            obj_ = buffer::take_target<T>(buf_.bytes, std::forward<F>(f));
+        }
     }
 
     template<auto f>
@@ -369,14 +482,14 @@ class move_only_function<S, R(Args...)>
         : vtbl_(trait::template unbound_callable_target<f>)
     {}
 
-    template<auto f, class T, class VT = std::decay_t<T>>
-    move_only_function(nontype_t<f>, T &&x) noexcept(
-        std::is_nothrow_invocable_v<decltype(_take_reference), T>)
+    template<auto f, class T, class VT = std::decay_t<T>,
+             class U = std::unwrap_ref_decay_t<T>>
+    move_only_function(nontype_t<f>, T &&x) noexcept(is_nothrow_taken<U, T>)
         requires is_callable_as_if_from<f, VT> and
                      std::is_constructible_v<VT, T>
-        : vtbl_(trait::template bound_callable_target<
-                f, std::unwrap_ref_decay_t<T>, inv_quals_f>),
-          obj_(_take_reference(std::forward<T>(x)))
+        : vtbl_(trait::template bound_callable_target<f, U, inv_quals_f,
+                                                      storage_for<U>>),
+          obj_(buffer::take_target<U>(buf_.bytes, std::forward<T>(x)))
     {}
 
     template<class M, class C, M C::*f, class T>
@@ -387,11 +500,12 @@ class move_only_function<S, R(Args...)>
 
     template<class T, class... Inits>
     explicit move_only_function(in_place_type_t<T>, Inits &&...inits) noexcept(
-        std::is_nothrow_invocable_v<decltype(_build_reference<T>), Inits...>)
+        is_nothrow_built<T, Inits...>)
         requires is_callable_from<T> and std::is_constructible_v<T, Inits...>
         : vtbl_(trait::template callable_target<std::unwrap_reference_t<T>,
-                                                inv_quals_f>),
-          obj_(_build_reference<T>(std::forward<Inits>(inits)...))
+                                                inv_quals_f, storage_for<T>>),
+          obj_(buffer::build_target<T>(buf_.bytes,
+                                       std::forward<Inits>(inits)...))
     {
         static_assert(std::is_same_v<std::decay_t<T>, T>);
     }
@@ -399,13 +513,13 @@ class move_only_function<S, R(Args...)>
     template<class T, class U, class... Inits>
     explicit move_only_function(in_place_type_t<T>, initializer_list<U> ilist,
                                 Inits &&...inits) noexcept( //
-        std::is_nothrow_invocable_v<decltype(_build_reference<T>),
-                                    decltype((ilist)), Inits...>)
+        is_nothrow_built<T, decltype((ilist)), Inits...>)
         requires is_callable_from<T> and
                      std::is_constructible_v<T, decltype((ilist)), Inits...>
         : vtbl_(trait::template callable_target<std::unwrap_reference_t<T>,
-                                                inv_quals_f>),
-          obj_(_build_reference<T>(ilist, std::forward<Inits>(inits)...))
+                                                inv_quals_f, storage_for<T>>),
+          obj_(buffer::build_target<T>(buf_.bytes, ilist,
+                                       std::forward<Inits>(inits)...))
     {
         static_assert(std::is_same_v<std::decay_t<T>, T>);
     }
@@ -413,12 +527,13 @@ class move_only_function<S, R(Args...)>
     template<auto f, class T, class... Inits>
     explicit move_only_function(nontype_t<f>, in_place_type_t<T>,
                                 Inits &&...inits) noexcept( //
-        std::is_nothrow_invocable_v<decltype(_build_reference<T>), Inits...>)
+        is_nothrow_built<T, Inits...>)
         requires is_callable_as_if_from<f, T> and
                      std::is_constructible_v<T, Inits...>
         : vtbl_(trait::template bound_callable_target<
-                f, std::unwrap_reference_t<T>, inv_quals_f>),
-          obj_(_build_reference<T>(std::forward<Inits>(inits)...))
+                f, std::unwrap_reference_t<T>, inv_quals_f, storage_for<T>>),
+          obj_(buffer::build_target<T>(buf_.bytes,
+                                       std::forward<Inits>(inits)...))
     {
         static_assert(std::is_same_v<std::decay_t<T>, T>);
     }
@@ -439,77 +554,147 @@ class move_only_function<S, R(Args...)>
     explicit move_only_function(nontype_t<f>, in_place_type_t<T>,
                                 initializer_list<U> ilist,
                                 Inits &&...inits) noexcept( //
-        std::is_nothrow_invocable_v<decltype(_build_reference<T>),
-                                    decltype((ilist)), Inits...>)
+        is_nothrow_built<T, decltype((ilist)), Inits...>)
         requires is_callable_as_if_from<f, T> and
                      std::is_constructible_v<T, decltype((ilist)), Inits...>
         : vtbl_(trait::template bound_callable_target<
-                f, std::unwrap_reference_t<T>, inv_quals_f>),
-          obj_(_build_reference<T>(ilist, std::forward<Inits>(inits)...))
+                f, std::unwrap_reference_t<T>, inv_quals_f, storage_for<T>>),
+          obj_(buffer::build_target<T>(buf_.bytes, ilist,
+                                       std::forward<Inits>(inits)...))
     {
         static_assert(std::is_same_v<std::decay_t<T>, T>);
     }
 
-    move_only_function(move_only_function &&) = default;
-    move_only_function &operator=(move_only_function &&) = default;
-
-    void swap(move_only_function &other) noexcept
+    template<class Alloc, class F, class VT = std::decay_t<F>>
+    move_only_function(std::allocator_arg_t t, Alloc const &a, F &&f)
+        requires _is_not_self<F, move_only_function> and
+                 _does_not_specialize<F, in_place_type_t> and
+                 is_callable_from<VT> and std::is_constructible_v<VT, F>
     {
-        std::swap<move_only_function>(*this, other);
+        if constexpr (_looks_nullable_to<F, move_only_function>)
+        {
+            if (f == nullptr)
+                return;
+        }
+
+        using T = std::unwrap_ref_decay_t<F>;
+        if constexpr (_is_stateless<T>)
+        {
+            vtbl_ = trait::template unbound_callable_target<
+                _stateless_call<T, inv_quals<T>>>;
+        }
+        else
+        {
+            using Storage = allocated_storage_for<T, Alloc>;
+            vtbl_ = trait::template callable_target<T, inv_quals_f, Storage>;
+            obj_ = take_target<T>(t, a, std::forward<F>(f));
+        }
     }
 
-    friend void swap(move_only_function &lhs, move_only_function &rhs) noexcept
+    template<class Alloc, auto f, class T, class VT = std::decay_t<T>,
+             class U = std::unwrap_ref_decay_t<T>>
+    move_only_function(std::allocator_arg_t t, Alloc const &a, nontype_t<f>,
+                       T &&x)
+        requires is_callable_as_if_from<f, VT> and
+                     std::is_constructible_v<VT, T>
+        : vtbl_(trait::template bound_callable_target<
+                f, U, inv_quals_f, allocated_storage_for<U, Alloc>>),
+          obj_(take_target<U>(t, a, std::forward<T>(x)))
+    {}
+
+    template<class Alloc, class T, class... Inits>
+    explicit move_only_function(std::allocator_arg_t t, Alloc const &a,
+                                in_place_type_t<T>, Inits &&...inits)
+        requires is_callable_from<T> and std::is_constructible_v<T, Inits...>
+        : vtbl_(trait::template callable_target<
+                std::unwrap_reference_t<T>, inv_quals_f,
+                allocated_storage_for<T, Alloc>>),
+          obj_(build_target<T>(t, a, std::forward<Inits>(inits)...))
     {
-        lhs.swap(rhs);
+        static_assert(std::is_same_v<std::decay_t<T>, T>);
     }
 
-    ~move_only_function() { vtbl_.get().destroy(obj_.val); }
+    template<class Alloc, class T, class U, class... Inits>
+    explicit move_only_function(std::allocator_arg_t t, Alloc const &a,
+                                in_place_type_t<T>, initializer_list<U> ilist,
+                                Inits &&...inits)
+        requires is_callable_from<T> and
+                     std::is_constructible_v<T, decltype((ilist)), Inits...>
+        : vtbl_(trait::template callable_target<
+                std::unwrap_reference_t<T>, inv_quals_f,
+                allocated_storage_for<T, Alloc>>),
+          obj_(build_target<T>(t, a, ilist, std::forward<Inits>(inits)...))
+    {
+        static_assert(std::is_same_v<std::decay_t<T>, T>);
+    }
 
-    explicit operator bool() const noexcept
+    template<class Alloc, auto f, class T, class... Inits>
+    explicit move_only_function(std::allocator_arg_t t, Alloc const &a,
+                                nontype_t<f>, in_place_type_t<T>,
+                                Inits &&...inits)
+        requires is_callable_as_if_from<f, T> and
+                     std::is_constructible_v<T, Inits...>
+        : vtbl_(trait::template bound_callable_target<
+                f, std::unwrap_reference_t<T>, inv_quals_f,
+                allocated_storage_for<T, Alloc>>),
+          obj_(build_target<T>(t, a, std::forward<Inits>(inits)...))
     {
-        return &vtbl_.get() != &trait::abstract_base;
+        static_assert(std::is_same_v<std::decay_t<T>, T>);
     }
 
-    friend bool operator==(move_only_function const &f, nullptr_t) noexcept
+    template<class S2, class F2>
+    move_only_function(move_only_function<S2, F2> &&other) noexcept
+        requires is_adoptable<move_only_function<S2, F2>>
     {
-        return !f;
+        adopt(other.release_into(buf_.bytes));
     }
 
-    R operator()(Args... args) noexcept(noex)
-        requires(!is_const and !is_lvalue_only and !is_rvalue_only)
+    template<class S2, class F2>
+    move_only_function(function<S2, F2> &&f) noexcept
+        requires is_adoptable<function<S2, F2>>
     {
-        return vtbl_.get().call(obj_.val, std::forward<Args>(args)...);
+        using copyable_function = function<S2, F2>::copyable_function;
+        static_assert(sizeof(buf_) >= copyable_function::inline_size);
+        adopt(f.release_into(buf_.bytes));
     }
 
-    R operator()(Args... args) const noexcept(noex)
-        requires(is_const and !is_lvalue_only and !is_rvalue_only)
+    template<class S2, class F2>
+    move_only_function(copyable_function<S2, F2> &&f) noexcept
+        requires is_adoptable<copyable_function<S2, F2>>
     {
-        return vtbl_.get().call(obj_.val, std::forward<Args>(args)...);
+        adopt(f.release_into(buf_.bytes));
     }
 
-    R operator()(Args... args) &noexcept(noex)
-        requires(!is_const and is_lvalue_only and !is_rvalue_only)
+    move_only_function(move_only_function &&other) noexcept
+        : vtbl_(std::exchange(other.vtbl_, trait::abstract_base)),
+          obj_(std::move(other.obj_))
     {
-        return vtbl_.get().call(obj_.val, std::forward<Args>(args)...);
+        if (auto relocate = vtbl_.get().relocate)
+            obj_.val = relocate(obj_.val, buf_.bytes);
     }
 
-    R operator()(Args... args) const &noexcept(noex)
-        requires(is_const and is_lvalue_only and !is_rvalue_only)
+    move_only_function &operator=(move_only_function &&other) noexcept
     {
-        return vtbl_.get().call(obj_.val, std::forward<Args>(args)...);
+        if (&other != this)
+        {
+            std::destroy_at(this);
+            return *std::construct_at(this, std::move(other));
+        }
+        else
+            return *this;
     }
 
-    R operator()(Args... args) &&noexcept(noex)
-        requires(!is_const and !is_lvalue_only and is_rvalue_only)
+    void swap(move_only_function &other) noexcept
     {
-        return vtbl_.get().call(obj_.val, std::forward<Args>(args)...);
+        std::swap<move_only_function>(*this, other);
     }
 
-    R operator()(Args... args) const &&noexcept(noex)
-        requires(is_const and !is_lvalue_only and is_rvalue_only)
+    friend void swap(move_only_function &lhs, move_only_function &rhs) noexcept
     {
-        return vtbl_.get().call(obj_.val, std::forward<Args>(args)...);
+        lhs.swap(rhs);
     }
+
+    ~move_only_function() { vtbl_.get().destroy(obj_.val); }
 };
 
 } // namespace std23
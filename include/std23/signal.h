@@ -0,0 +1,205 @@
+#ifndef INCLUDE_STD23_SIGNAL
+#define INCLUDE_STD23_SIGNAL
+
+#include "move_only_function.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace std23
+{
+
+template<class S, class = typename _full_fn_sig<S>::function> class signal;
+
+// Identifies a slot of a signal.  A connection outlives its slot: once the
+// slot is disconnected, the connection refers to nothing, even after the
+// signal reuses the slot for another target.
+class connection
+{
+    template<class, class> friend class signal;
+
+    std::uint32_t index_ = UINT32_MAX;
+    std::uint32_t generation_ = 0;
+
+    constexpr connection(std::uint32_t index, std::uint32_t generation) noexcept
+        : index_(index), generation_(generation)
+    {}
+
+  public:
+    connection() = default;
+
+    friend bool operator==(connection, connection) = default;
+};
+
+// Calls every connected slot, in order of their slots, when emitted.  Slots
+// are move_only_function<S>, and they are called with the qualifiers in S;
+// S may not be rvalue-qualified, since every slot is called on each emit.
+// Slots may connect and disconnect slots (including themselves) while the
+// signal is being emitted; the slots connected during an emission are not
+// called until the next one.
+template<class S, class R, class... Args> class signal<S, R(Args...)>
+{
+    using signature = _full_fn_sig<S>;
+
+    template<class T> using cv = signature::template cv<T>;
+    template<class T> using ref = signature::template ref<T>;
+
+    static constexpr bool noex = signature::is_noexcept;
+    static_assert(not std::is_same_v<ref<int>, int &&>,
+                  "a slot called on every emit cannot be called as an "
+                  "rvalue");
+
+    template<class T> using inv_quals = cv<T> &;
+
+    static constexpr std::uint32_t npos = UINT32_MAX;
+
+    using slot_type = move_only_function<S>;
+
+    // A slot is live if its generation is odd
+    struct entry
+    {
+        slot_type fn;
+        std::uint32_t generation = 0;
+        std::uint32_t next = npos; // in the free list or the graveyard
+
+        bool is_live() const noexcept { return generation % 2 != 0; }
+    };
+
+    // Slots stay at the same address until the signal is destroyed
+    static constexpr std::uint32_t block_size = 32;
+    using block = std::array<entry, block_size>;
+
+    std::vector<std::unique_ptr<block>> blocks_;
+    std::uint32_t used_ = 0;
+    std::uint32_t live_ = 0;
+    std::uint32_t free_ = npos;
+    std::uint32_t graveyard_ = npos; // disconnected while emitting
+    int emitting_ = 0;
+
+    entry &at(std::uint32_t i) const noexcept
+    {
+        return (*blocks_[i / block_size])[i % block_size];
+    }
+
+    std::uint32_t allocate_slot()
+    {
+        // Reusing a slot that the ongoing emission has yet to visit would
+        // call the new target in the emission
+        if (free_ != npos and emitting_ == 0)
+            return std::exchange(free_, at(free_).next);
+
+        if (used_ == blocks_.size() * block_size)
+            blocks_.push_back(std::make_unique<block>());
+
+        return used_++;
+    }
+
+    void release_slot(std::uint32_t i) noexcept
+    {
+        auto &e = at(i);
+        e.fn = nullptr;
+        e.next = std::exchange(free_, i);
+    }
+
+    void bury_the_dead() noexcept
+    {
+        while (graveyard_ != npos)
+        {
+            auto i = std::exchange(graveyard_, at(graveyard_).next);
+            release_slot(i);
+        }
+    }
+
+    template<class T>
+    static constexpr bool is_shareable =
+        std::is_lvalue_reference_v<T> or
+        (std::is_object_v<T> and std::is_copy_constructible_v<T>);
+
+  public:
+    signal() = default;
+    signal(signal const &) = delete;
+    signal &operator=(signal const &) = delete;
+
+    template<class F>
+    connection connect(F &&f)
+        requires std::is_constructible_v<slot_type, F>
+    {
+        slot_type fn(std::forward<F>(f));
+        if (fn == nullptr)
+            return {};
+
+        auto i = allocate_slot();
+        auto &e = at(i);
+        e.fn = std::move(fn);
+        ++e.generation;
+        ++live_;
+        return {i, e.generation};
+    }
+
+    bool connected(connection c) const noexcept
+    {
+        return c.index_ < used_ and at(c.index_).generation == c.generation_;
+    }
+
+    // A slot disconnected while the signal is being emitted is destroyed
+    // when the outermost emission returns
+    bool disconnect(connection c) noexcept
+    {
+        if (not connected(c))
+            return false;
+
+        auto &e = at(c.index_);
+        ++e.generation;
+        --live_;
+
+        if (emitting_ != 0)
+            e.next = std::exchange(graveyard_, c.index_);
+        else
+            release_slot(c.index_);
+
+        return true;
+    }
+
+    void disconnect_all() noexcept
+    {
+        for (std::uint32_t i = 0; i != used_; ++i)
+        {
+            if (at(i).is_live())
+                disconnect({i, at(i).generation});
+        }
+    }
+
+    std::uint32_t size() const noexcept { return live_; }
+    [[nodiscard]] bool empty() const noexcept { return live_ == 0; }
+
+    // Each slot receives its own copy of the arguments taken by value
+    void emit(Args... args) noexcept(
+        noex and (std::is_nothrow_constructible_v<Args, Args &> and ...))
+        requires(is_shareable<Args> and ...)
+    {
+        struct guard
+        {
+            signal *self;
+
+            ~guard()
+            {
+                if (--self->emitting_ == 0)
+                    self->bury_the_dead();
+            }
+        };
+
+        ++emitting_;
+        guard _{this};
+
+        for (std::uint32_t i = 0, n = used_; i != n; ++i)
+        {
+            if (auto &e = at(i); e.is_live())
+                static_cast<inv_quals<slot_type>>(e.fn)(Args(args)...);
+        }
+    }
+};
+
+} // namespace std23
+
+#endif
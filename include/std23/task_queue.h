@@ -0,0 +1,145 @@
+#ifndef INCLUDE_STD23_TASK__QUEUE
+#define INCLUDE_STD23_TASK__QUEUE
+
+#include "move_only_function.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <thread>
+
+namespace std23
+{
+
+// A bounded queue of move_only_function<S> that many threads may push to
+// and one thread pops from, without locking.  Each cell of the ring holds a
+// wrapper in place, so pushing a task relocates the wrapper into the cell
+// and publishes it with one store.  The algorithm is Dmitry Vyukov's
+// bounded MPMC queue with a single consumer.
+template<class S = void() &&> class task_queue
+{
+  public:
+    using value_type = move_only_function<S>;
+
+  private:
+    // Keeps producers writing to neighboring cells off each other's cache
+    // lines
+    struct alignas(64) cell
+    {
+        std::atomic<std::size_t> seq;
+        value_type fn;
+    };
+
+    std::unique_ptr<cell[]> cells_;
+    std::size_t mask_;
+    alignas(64) std::atomic<std::size_t> tail_ = 0; // next push
+    alignas(64) std::size_t head_ = 0;              // next pop
+
+    cell *claim() noexcept
+    {
+        auto pos = tail_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            auto &c = cells_[pos & mask_];
+            auto seq = c.seq.load(std::memory_order_acquire);
+            auto dif = static_cast<std::intptr_t>(seq - pos);
+            if (dif == 0)
+            {
+                if (tail_.compare_exchange_weak(pos, pos + 1,
+                                                std::memory_order_relaxed))
+                    return &c;
+            }
+            else if (dif < 0)
+                return nullptr;
+            else
+                pos = tail_.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell *ready() const noexcept
+    {
+        auto &c = cells_[head_ & mask_];
+        if (c.seq.load(std::memory_order_acquire) != head_ + 1)
+            return nullptr;
+
+        return &c;
+    }
+
+    void release(cell &c) noexcept
+    {
+        c.seq.store(head_ + mask_ + 1, std::memory_order_release);
+        ++head_;
+    }
+
+  public:
+    // The capacity is rounded up to a power of two
+    explicit task_queue(std::size_t capacity)
+        : mask_(std::bit_ceil(std::max(capacity, std::size_t(2))) - 1)
+    {
+        cells_ = std::make_unique<cell[]>(mask_ + 1);
+        for (std::size_t i = 0; i <= mask_; ++i)
+            cells_[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    task_queue(task_queue const &) = delete;
+    task_queue &operator=(task_queue const &) = delete;
+
+    std::size_t capacity() const noexcept { return mask_ + 1; }
+
+    // Leaves fn untouched if the queue is full.  Any thread.
+    bool try_push(value_type &&fn) noexcept
+    {
+        auto c = claim();
+        if (c == nullptr)
+            return false;
+
+        auto pos = c->seq.load(std::memory_order_relaxed);
+        c->fn = std::move(fn);
+        c->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Waits for room if the queue is full.  Any thread.
+    void push(value_type &&fn) noexcept
+    {
+        while (not try_push(std::move(fn)))
+            std::this_thread::yield();
+    }
+
+    // The consumer thread only
+    bool try_pop(value_type &fn) noexcept
+    {
+        auto c = ready();
+        if (c == nullptr)
+            return false;
+
+        fn = std::move(c->fn);
+        release(*c);
+        return true;
+    }
+
+    // Pops as many tasks as are ready and fit in out, and returns how many.
+    // The consumer thread only.
+    std::size_t try_pop(std::span<value_type> out) noexcept
+    {
+        std::size_t n = 0;
+        for (; n != out.size(); ++n)
+        {
+            auto c = ready();
+            if (c == nullptr)
+                break;
+
+            out[n] = std::move(c->fn);
+            release(*c);
+        }
+
+        return n;
+    }
+};
+
+} // namespace std23
+
+#endif
@@ -0,0 +1,306 @@
+#ifndef INCLUDE_STD23_THREAD__POOL
+#define INCLUDE_STD23_THREAD__POOL
+
+#include "task_queue.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace std23
+{
+
+// A Chase-Lev work-stealing deque of bounded capacity.  The owner pushes
+// and pops at the bottom; other threads steal from the top.  A thief moves
+// the task out of its cell only after it has won the cell, and the owner
+// does not reuse a cell until the thief has cleared its flag.
+// See also: https://fzn.fr/readings/ppopp13.pdf
+class _work_deque
+{
+    using task = move_only_function<void() &&>;
+
+    struct cell
+    {
+        std::atomic<bool> full = false;
+        task fn;
+    };
+
+    static constexpr std::int64_t capacity = 256;
+
+    alignas(64) std::atomic<std::int64_t> top_ = 0;
+    alignas(64) std::atomic<std::int64_t> bottom_ = 0;
+    std::unique_ptr<cell[]> cells_ = std::make_unique<cell[]>(capacity);
+
+    cell &at(std::int64_t i) const noexcept
+    {
+        return cells_[static_cast<std::size_t>(i & (capacity - 1))];
+    }
+
+  public:
+    // Leaves fn untouched if the deque is full.  The owner only.
+    bool push(task &fn) noexcept
+    {
+        auto b = bottom_.load(std::memory_order_relaxed);
+        auto t = top_.load(std::memory_order_acquire);
+        auto &c = at(b);
+        if (b - t >= capacity or c.full.load(std::memory_order_acquire))
+            return false;
+
+        c.fn = std::move(fn);
+        c.full.store(true, std::memory_order_relaxed);
+        bottom_.store(b + 1, std::memory_order_release);
+        return true;
+    }
+
+    // The owner only
+    bool pop(task &fn) noexcept
+    {
+        auto b = bottom_.load(std::memory_order_relaxed) - 1;
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto t = top_.load(std::memory_order_relaxed);
+
+        if (t > b)
+        {
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        if (t == b)
+        {
+            bool won = top_.compare_exchange_strong(
+                t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            if (not won)
+                return false;
+        }
+
+        auto &c = at(b);
+        fn = std::move(c.fn);
+        c.full.store(false, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Any thread
+    bool steal(task &fn) noexcept
+    {
+        auto t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto b = bottom_.load(std::memory_order_acquire);
+
+        if (t >= b or
+            not top_.compare_exchange_strong(t, t + 1,
+                                             std::memory_order_seq_cst,
+                                             std::memory_order_relaxed))
+            return false;
+
+        auto &c = at(t);
+        fn = std::move(c.fn);
+        c.full.store(false, std::memory_order_release);
+        return true;
+    }
+};
+
+// Runs move_only_function<void() &&> tasks on a fixed set of threads.  Each
+// worker runs the tasks it submits from its own deque, last in first out,
+// and steals from the deques of randomly chosen workers when it runs out.
+// Tasks submitted from other threads go to the workers' inboxes in turn.
+// Submitting a task that move_only_function stores inline does not
+// allocate.  The destructor waits for every task, including those that the
+// tasks submit, to finish.  A task that throws calls std::terminate.  A
+// pool asked for no threads gets one.
+class thread_pool
+{
+  public:
+    using task = move_only_function<void() &&>;
+
+  private:
+    struct alignas(64) worker
+    {
+        _work_deque deque;
+        task_queue<void() &&> inbox{256};
+        std::atomic<std::uint32_t> wake = 0;
+        std::atomic<bool> sleeping = false;
+        std::uint32_t seed;
+        std::thread thread;
+
+        explicit worker(std::uint32_t n) noexcept : seed(n * 2654435761u | 1)
+        {}
+
+        std::uint32_t random() noexcept
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            return seed;
+        }
+
+        void notify() noexcept
+        {
+            wake.fetch_add(1, std::memory_order_seq_cst);
+            wake.notify_one();
+        }
+    };
+
+    std::vector<std::unique_ptr<worker>> workers_;
+    std::atomic<std::size_t> next_ = 0;
+    std::atomic<bool> stop_ = false;
+    // Tasks submitted and not yet finished.  A task may submit more tasks,
+    // so the workers stay until this drops to zero after stop_ is set.
+    alignas(64) std::atomic<std::size_t> pending_ = 0;
+
+    static inline thread_local thread_pool *current_pool_ = nullptr;
+    static inline thread_local worker *current_ = nullptr;
+
+    // Moves a batch from the inbox to the deque, where thieves can see it
+    bool take_inbox(worker &self, task &fn) noexcept
+    {
+        std::array<task, 16> batch;
+        auto n = self.inbox.try_pop(batch);
+        if (n == 0)
+            return false;
+
+        fn = std::move(batch[0]);
+        for (std::size_t i = 1; i != n; ++i)
+        {
+            if (not self.deque.push(batch[i]))
+                execute(batch[i]);
+        }
+
+        if (n > 1)
+            wake_one_sleeper(self);
+
+        return true;
+    }
+
+    bool find_work(worker &self, task &fn) noexcept
+    {
+        if (self.deque.pop(fn) or take_inbox(self, fn))
+            return true;
+
+        auto n = workers_.size();
+        auto first = self.random() % n;
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            auto &victim = *workers_[(first + i) % n];
+            if (&victim != &self and victim.deque.steal(fn))
+                return true;
+        }
+
+        return false;
+    }
+
+    void wake_one_sleeper(worker &self) noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto n = workers_.size();
+        auto first = self.random() % n;
+        for (std::size_t i = 0; i != n; ++i)
+        {
+            auto &w = *workers_[(first + i) % n];
+            if (w.sleeping.load(std::memory_order_relaxed))
+                return w.notify();
+        }
+    }
+
+    void execute(task &fn) noexcept
+    {
+        std::move(fn)();
+        fn = nullptr;
+        if (pending_.fetch_sub(1, std::memory_order_seq_cst) == 1 and
+            stop_.load(std::memory_order_seq_cst))
+        {
+            for (auto &w : workers_)
+                w->notify();
+        }
+    }
+
+    void run(worker &self) noexcept
+    {
+        current_pool_ = this;
+        current_ = &self;
+        task fn;
+        for (;;)
+        {
+            if (find_work(self, fn))
+            {
+                execute(fn);
+                continue;
+            }
+
+            auto seen = self.wake.load(std::memory_order_seq_cst);
+            self.sleeping.store(true, std::memory_order_seq_cst);
+            if (find_work(self, fn))
+            {
+                self.sleeping.store(false, std::memory_order_relaxed);
+                execute(fn);
+                continue;
+            }
+
+            if (stop_.load(std::memory_order_seq_cst) and
+                pending_.load(std::memory_order_seq_cst) == 0)
+                break;
+
+            self.wake.wait(seen, std::memory_order_seq_cst);
+            self.sleeping.store(false, std::memory_order_relaxed);
+        }
+    }
+
+  public:
+    explicit thread_pool(
+        unsigned threads = std::max(std::thread::hardware_concurrency(), 1u))
+    {
+        threads = std::max(threads, 1u);
+        for (unsigned i = 0; i != threads; ++i)
+            workers_.push_back(std::make_unique<worker>(i + 1));
+
+        for (auto &w : workers_)
+            w->thread = std::thread([this, &w = *w] { run(w); });
+    }
+
+    thread_pool(thread_pool const &) = delete;
+    thread_pool &operator=(thread_pool const &) = delete;
+
+    ~thread_pool()
+    {
+        stop_.store(true, std::memory_order_seq_cst);
+        for (auto &w : workers_)
+            w->notify();
+
+        for (auto &w : workers_)
+            w->thread.join();
+    }
+
+    std::size_t size() const noexcept { return workers_.size(); }
+
+    template<class F>
+    void submit(F &&f) requires std::is_constructible_v<task, F>
+    {
+        task fn(std::forward<F>(f));
+        pending_.fetch_add(1, std::memory_order_relaxed);
+
+        if (current_pool_ == this)
+        {
+            auto &self = *current_;
+            if (self.deque.push(fn))
+                wake_one_sleeper(self);
+            else
+                execute(fn);
+        }
+        else
+        {
+            auto i = next_.fetch_add(1, std::memory_order_relaxed);
+            auto &w = *workers_[i % workers_.size()];
+            w.inbox.push(std::move(fn));
+            w.notify();
+        }
+    }
+};
+
+} // namespace std23
+
+#endif
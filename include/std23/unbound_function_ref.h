@@ -0,0 +1,88 @@
+#ifndef INCLUDE_STD23_UNBOUND__FUNCTION__REF
+#define INCLUDE_STD23_UNBOUND__FUNCTION__REF
+
+#include "function_ref.h"
+
+#include <utility>
+
+namespace std23
+{
+
+template<class Sig, class = typename _qual_fn_sig<Sig>::function>
+class unbound_function_ref; // freestanding
+
+// A function_ref that refers to no object, and so holds a single pointer:
+// the thunk that calls an unbound NTTP callable, or a function whose
+// parameters are exactly those that function_ref passes to its thunks.
+// A function_ref constructed from it holds that function and calls it
+// through a shared thunk, without referring to the unbound_function_ref.
+template<class Sig, class R, class... Args>
+class unbound_function_ref<Sig, R(Args...)> // freestanding
+{
+    using signature = _qual_fn_sig<Sig>;
+    using storage = _function_ref_base::storage;
+
+    static constexpr bool noex = signature::is_noexcept;
+
+    template<class... T>
+    static constexpr bool is_invocable_using =
+        signature::template is_invocable_using<T...>;
+
+    typedef R fn_t(_param_t<Args>...) noexcept(noex);
+    fn_t *fptr_;
+
+    template<class, class> friend class function_ref;
+
+    constexpr auto direct_call() const noexcept
+    {
+        return std::pair(
+            [](storage fn_, _param_t<Args>... args) noexcept(noex) -> R {
+                return _function_ref_base::get<fn_t>(fn_)(
+                    static_cast<decltype(args)>(args)...);
+            },
+            storage(fptr_));
+    }
+
+  public:
+    constexpr unbound_function_ref(fn_t *f) noexcept : fptr_(f)
+    {
+        assert(f != nullptr && "must reference a function");
+    }
+
+    template<auto f>
+    constexpr unbound_function_ref(nontype_t<f>) noexcept
+        requires is_invocable_using<decltype(f)>
+        : fptr_([](_param_t<Args>... args) noexcept(noex) -> R {
+              return std23::invoke_r<R>(f,
+                                        static_cast<decltype(args)>(args)...);
+          })
+    {
+        using F = decltype(f);
+        if constexpr (std::is_pointer_v<F> or std::is_member_pointer_v<F>)
+            static_assert(f != nullptr, "NTTP callable must be usable");
+    }
+
+    constexpr R operator()(Args... args) const noexcept(noex)
+    {
+        return fptr_(std::forward<Args>(args)...);
+    }
+};
+
+// Whether a function may be referred to by the unbound_function_ref of its
+// own type
+template<class F> inline constexpr bool _takes_param_types = false;
+
+template<class R, class... Args, bool noex>
+inline constexpr bool _takes_param_types<R(Args...) noexcept(noex)> =
+    (std::is_same_v<Args, _param_t<Args>> and ...);
+
+template<class F> requires _takes_param_types<F>
+unbound_function_ref(F *) -> unbound_function_ref<F>;
+
+template<auto V>
+unbound_function_ref(nontype_t<V>)
+    -> unbound_function_ref<_adapt_signature_t<decltype(V)>>;
+
+} // namespace std23
+
+#endif
@@ -0,0 +1,351 @@
+#include "std23/function.h"
+#include "std23/inplace_move_only_function.h"
+#include "std23/move_only_function.h"
+
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+
+// Counts calls to the global allocation functions made by each operation on
+// the wrappers, and fails if any of them allocates more than expected.
+
+namespace
+{
+
+std::size_t allocations = 0;
+std::size_t deallocations = 0;
+
+void *allocate(std::size_t n, std::size_t align)
+{
+    ++allocations;
+    n = n ? n : 1;
+#ifdef _MSC_VER
+    auto p = align ? _aligned_malloc(n, align) : std::malloc(n);
+#else
+    auto p = align ? std::aligned_alloc(align, (n + align - 1) / align * align)
+                   : std::malloc(n);
+#endif
+    if (p == nullptr)
+        throw std::bad_alloc();
+    return p;
+}
+
+void deallocate(void *p, [[maybe_unused]] std::size_t align) noexcept
+{
+    if (p == nullptr)
+        return;
+
+    ++deallocations;
+#ifdef _MSC_VER
+    if (align)
+        return _aligned_free(p);
+#endif
+    std::free(p);
+}
+
+} // namespace
+
+void *operator new(std::size_t n)
+{
+    return allocate(n, 0);
+}
+
+void *operator new(std::size_t n, std::align_val_t al)
+{
+    return allocate(n, static_cast<std::size_t>(al));
+}
+
+void operator delete(void *p) noexcept
+{
+    deallocate(p, 0);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    deallocate(p, 0);
+}
+
+void operator delete(void *p, std::align_val_t al) noexcept
+{
+    deallocate(p, static_cast<std::size_t>(al));
+}
+
+void operator delete(void *p, std::size_t, std::align_val_t al) noexcept
+{
+    deallocate(p, static_cast<std::size_t>(al));
+}
+
+namespace
+{
+
+using std23::in_place_type;
+using std23::nontype;
+
+int plain(int x)
+{
+    return x;
+}
+
+struct small_callable
+{
+    void *p = nullptr;
+
+    int operator()(int x) const { return x; }
+};
+
+struct large_callable
+{
+    std::array<void *, 8> p{};
+
+    int operator()(int x) const { return x; }
+};
+
+struct worker
+{
+    int base = 1;
+
+    int work(int x) const { return base + x; }
+};
+
+struct large_worker : worker
+{
+    std::array<void *, 8> p{};
+};
+
+enum operation : std::size_t
+{
+    constructing,
+    moving,
+    copying,
+    swapping,
+    destroying,
+    operation_count
+};
+
+constexpr int na = -1;
+using counts = std::array<int, operation_count>;
+
+struct stats
+{
+    int allocated = na;
+    int deallocated = na;
+};
+
+class counter
+{
+    std::size_t allocations_ = allocations;
+    std::size_t deallocations_ = deallocations;
+
+  public:
+    stats result() const
+    {
+        return {static_cast<int>(allocations - allocations_),
+                static_cast<int>(deallocations - deallocations_)};
+    }
+};
+
+int failures = 0;
+
+void report(char const *wrapper, char const *target, counts const &expected,
+            std::array<stats, operation_count> const &actual)
+{
+    std::printf("%-28s %-40s", wrapper, target);
+    for (std::size_t op = 0; op < operation_count; ++op)
+    {
+        auto [allocated, deallocated] = actual[op];
+        if (allocated == na)
+            std::printf(" %9s", "-");
+        else
+            std::printf(" %7d/%d", allocated, deallocated);
+    }
+    std::printf("\n");
+
+    char const *names[] = {"construct", "move", "copy", "swap", "destroy"};
+    int leaked = 0;
+    for (std::size_t op = 0; op < operation_count; ++op)
+    {
+        auto [allocated, deallocated] = actual[op];
+        if (allocated == na)
+            continue;
+
+        leaked += allocated - deallocated;
+        if (allocated > expected[op])
+        {
+            std::printf("  FAIL: %s allocates %d time(s), expected %d\n",
+                        names[op], allocated, expected[op]);
+            ++failures;
+        }
+        else if (allocated < expected[op])
+        {
+            std::printf("  note: %s allocates %d time(s), down from %d; "
+                        "lower the expectation\n",
+                        names[op], allocated, expected[op]);
+        }
+    }
+
+    if (leaked > 0)
+    {
+        std::printf("  FAIL: %d allocation(s) leaked\n", leaked);
+        ++failures;
+    }
+}
+
+// Arguments are evaluated before the counting starts.  Copying includes
+// destroying the copy.
+template<class W, class... Args>
+void measure(char const *wrapper, char const *target, counts const &expected,
+             Args &&...args)
+{
+    std::array<stats, operation_count> actual;
+    alignas(W) std::byte buf[sizeof(W)];
+    W *p;
+
+    {
+        counter c;
+        p = ::new (static_cast<void *>(buf)) W(std::forward<Args>(args)...);
+        actual[constructing] = c.result();
+    }
+
+    W fn = [&]
+    {
+        counter c;
+        W tmp(std::move(*p));
+        actual[moving] = c.result();
+        return tmp;
+    }();
+    std::destroy_at(p);
+
+    if constexpr (std::is_copy_constructible_v<W>)
+    {
+        counter c;
+        {
+            W tmp(fn);
+        }
+        actual[copying] = c.result();
+    }
+
+    {
+        W other;
+        counter c;
+        swap(fn, other);
+        swap(fn, other);
+        actual[swapping] = c.result();
+    }
+
+    {
+        counter c;
+        std::destroy_at(&fn);
+        actual[destroying] = c.result();
+        std::construct_at(&fn);
+    }
+
+    report(wrapper, target, expected, actual);
+}
+
+void move_only_function_allocations()
+{
+    using W = std23::move_only_function<int(int)>;
+    char const *wrapper = "move_only_function";
+    worker obj;
+    small_callable callee;
+
+    measure<W>(wrapper, "callable_target (function pointer)", {0, 0, na, 0, 0},
+               &plain);
+    measure<W>(wrapper, "callable_target (reference_wrapper)",
+               {0, 0, na, 0, 0}, std::ref(callee));
+    measure<W>(wrapper, "callable_target (inline object)", {0, 0, na, 0, 0},
+               small_callable{});
+    measure<W>(wrapper, "callable_target (heap object)", {1, 0, na, 0, 0},
+               large_callable{});
+    measure<W>(wrapper, "callable_target (in_place)", {1, 0, na, 0, 0},
+               in_place_type<large_callable>);
+    measure<W>(wrapper, "unbound_callable_target", {0, 0, na, 0, 0},
+               nontype<plain>);
+    measure<W>(wrapper, "unbound_callable_target (stateless object)",
+               {0, 0, na, 0, 0}, [](int x) { return x; });
+    measure<W>(wrapper, "bound_callable_target (pointer)", {0, 0, na, 0, 0},
+               nontype<&worker::work>, &obj);
+    measure<W>(wrapper, "bound_callable_target (inline object)",
+               {0, 0, na, 0, 0}, nontype<&worker::work>, worker{});
+    measure<W>(wrapper, "bound_callable_target (heap object)",
+               {1, 0, na, 0, 0}, nontype<&worker::work>, large_worker{});
+    measure<W>(wrapper, "boxed_callable_target", {0, 0, na, 0, 0},
+               nontype<&worker::work>, std::make_unique<worker>());
+
+    // Compatible wrappers hand over their targets rather than being wrapped
+    measure<W>(wrapper, "adopted move_only_function (heap object)",
+               {0, 0, na, 0, 0},
+               std23::move_only_function<int(int) const>(large_callable{}));
+    measure<W>(wrapper, "adopted function (heap object)", {0, 0, na, 0, 0},
+               std23::function<int(int)>(large_callable{}));
+    measure<W>(wrapper, "adopted function (inline object)", {0, 0, na, 0, 0},
+               std23::function<int(int)>(small_callable{}));
+}
+
+void inplace_move_only_function_allocations()
+{
+    using W = std23::inplace_move_only_function<int(int)>;
+    char const *wrapper = "inplace_move_only_function";
+    worker obj;
+
+    measure<W>(wrapper, "callable_target (function pointer)", {0, 0, na, 0, 0},
+               &plain);
+    measure<W>(wrapper, "callable_target (inline object)", {0, 0, na, 0, 0},
+               small_callable{});
+    measure<W>(wrapper, "bound_callable_target (pointer)", {0, 0, na, 0, 0},
+               nontype<&worker::work>, &obj);
+    measure<W>(wrapper, "bound_callable_target (inline object)",
+               {0, 0, na, 0, 0}, nontype<&worker::work>, worker{});
+}
+
+void function_allocations()
+{
+    using W = std23::function<int(int)>;
+    char const *wrapper = "function";
+    worker obj;
+    small_callable callee;
+
+    measure<W>(wrapper, "empty_target_object", {0, 0, 0, 0, 0});
+    measure<W>(wrapper, "target_object (function pointer)", {0, 0, 0, 0, 0},
+               &plain);
+    measure<W>(wrapper, "target_object (reference_wrapper)", {0, 0, 0, 0, 0},
+               std::ref(callee));
+    measure<W>(wrapper, "target_object (inline object)", {0, 0, 0, 0, 0},
+               small_callable{});
+    measure<W>(wrapper, "target_object (inline shared_ptr)", {0, 0, 0, 0, 0},
+               [p = std::make_shared<int>()](int x) { return *p + x; });
+    measure<W>(wrapper, "target_object (heap object)", {1, 0, 1, 0, 0},
+               large_callable{});
+    measure<W>(wrapper, "unbound_target_object", {0, 0, 0, 0, 0},
+               nontype<plain>);
+    measure<W>(wrapper, "unbound_target_object (stateless object)",
+               {0, 0, 0, 0, 0}, [](int x) { return x; });
+    measure<W>(wrapper, "bound_target_object (pointer)", {0, 0, 0, 0, 0},
+               nontype<&worker::work>, &obj);
+    measure<W>(wrapper, "bound_target_object (inline object)",
+               {0, 0, 0, 0, 0}, nontype<&worker::work>, worker{});
+    measure<W>(wrapper, "bound_target_object (heap object)", {1, 0, 1, 0, 0},
+               nontype<&worker::work>, large_worker{});
+}
+
+} // namespace
+
+int main()
+{
+    std::printf("%-28s %-40s %9s %9s %9s %9s %9s\n", "Wrapper", "Target",
+                "construct", "move", "copy", "swap", "destroy");
+    std::printf("%s\n", std::string(119, '-').c_str());
+
+    move_only_function_allocations();
+    inplace_move_only_function_allocations();
+    function_allocations();
+
+    if (failures != 0)
+    {
+        std::printf("\n%d regression(s)\n", failures);
+        return EXIT_FAILURE;
+    }
+}
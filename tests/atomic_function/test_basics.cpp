@@ -0,0 +1,178 @@
+#include "std23/atomic_function.h"
+
+#include <boost/ut.hpp>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace boost::ut;
+
+using std23::atomic_function;
+
+struct canary
+{
+    inline static std::atomic<int> live = 0;
+    inline static std::atomic<int> called_dead = 0;
+
+    int id;
+    bool alive = true;
+
+    explicit canary(int n) : id(n) { ++live; }
+    canary(canary &&other) noexcept : id(other.id) { ++live; }
+    ~canary()
+    {
+        alive = false;
+        --live;
+    }
+
+    int operator()(int x) const
+    {
+        if (not alive)
+            ++called_dead;
+
+        return id + x;
+    }
+};
+
+suite basics = []
+{
+    using namespace bdd;
+
+    feature("calls go to the target stored last") = []
+    {
+        given("an empty atomic_function") = []
+        {
+            atomic_function<int(int) const> fn;
+
+            then("it is empty") = [&] { expect(not fn); };
+
+            when("a target is stored") = [&]
+            {
+                fn.store(canary(10));
+
+                then("it is called") = [&]
+                {
+                    expect(bool(fn));
+                    expect(fn(1) == 11_i);
+                };
+            };
+
+            when("it is exchanged") = [&]
+            {
+                auto old = fn.exchange([](int x) { return x * 2; });
+
+                then("the old target is handed back") = [&]
+                {
+                    expect(fn(3) == 6_i);
+                    expect(old(3) == 13_i);
+                };
+            };
+
+            when("nothing is stored") = [&]
+            {
+                fn.store(nullptr);
+
+                then("it is empty again") = [&] { expect(not fn); };
+            };
+        };
+
+        given("a move-only target") = []
+        {
+            atomic_function<int()> fn(
+                [p = std::make_unique<int>(42)] { return *p; });
+
+            then("it is called") = [&] { expect(fn() == 42_i); };
+        };
+
+        then("no target is leaked") = []
+        { expect(canary::live.load() == 0_i); };
+    };
+
+    feature("storing waits for the callers of the old target") = []
+    {
+        given("a caller inside the old target") = []
+        {
+            std::atomic<int> state = 0;
+            atomic_function<void()> fn(
+                [&state]
+                {
+                    state = 1;
+                    state.wait(1); // until the writer has started
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                    state = 3;
+                });
+
+            std::thread caller([&] { fn(); });
+            state.wait(0);
+
+            when("another target is stored") = [&]
+            {
+                auto old = [&]
+                {
+                    state = 2;
+                    state.notify_one();
+                    return fn.exchange([] {});
+                }();
+
+                then("the old target is returned after the call") = [&]
+                {
+                    expect(state.load() == 3_i);
+                    expect(bool(old));
+                };
+            };
+
+            caller.join();
+        };
+    };
+
+    feature("many threads may call while one stores") = []
+    {
+        given("four callers") = []
+        {
+            constexpr int stores = 1000;
+
+            atomic_function<int(int) const> fn(canary(0));
+            std::atomic<bool> stop = false;
+            std::atomic<bool> out_of_order = false;
+            std::vector<std::thread> callers;
+            for (int i = 0; i != 4; ++i)
+            {
+                callers.emplace_back(
+                    [&]
+                    {
+                        int last = 0;
+                        while (not stop.load())
+                        {
+                            auto n = fn(0);
+                            if (n < last)
+                                out_of_order = true;
+                            last = n;
+                        }
+                    });
+            }
+
+            when("a writer stores new targets") = [&]
+            {
+                for (int i = 1; i <= stores; ++i)
+                    fn.store(canary(i));
+
+                stop = true;
+                for (auto &t : callers)
+                    t.join();
+
+                then("every old target is destroyed") = [&]
+                {
+                    expect(canary::live.load() == 1_i);
+                    expect(canary::called_dead.load() == 0_i);
+                    expect(not out_of_order.load());
+                    expect(fn(0) == stores);
+                };
+            };
+        };
+    };
+};
+
+static_assert(not std::is_copy_constructible_v<atomic_function<void()>>);
+static_assert(noexcept(std::declval<atomic_function<void() noexcept> &>()()));
@@ -0,0 +1,241 @@
+#include "std23/copyable_function.h"
+
+#include <boost/ut.hpp>
+
+#include <array>
+#include <memory>
+#include <string>
+
+using namespace boost::ut;
+
+using std23::copyable_function;
+using std23::nontype;
+
+template<std::size_t N> struct counted
+{
+    inline static int live = 0;
+    std::array<void *, N> padding{};
+    int n = 0;
+
+    counted() { ++live; }
+    counted(counted const &other) : n(other.n + 1) { ++live; }
+    counted(counted &&other) noexcept : n(other.n) { ++live; }
+    ~counted() { --live; }
+
+    int operator()() const { return n; }
+};
+
+using small = counted<1>;
+using large = counted<8>;
+
+struct adder
+{
+    int base;
+
+    int add(int x) const { return base + x; }
+};
+
+int twice(int x)
+{
+    return x * 2;
+}
+
+suite basics = []
+{
+    using namespace bdd;
+
+    feature("copying the target") = []
+    {
+        given("a target stored inline") = []
+        {
+            {
+                copyable_function<int() const> fn = small{};
+
+                when("the wrapper is copied") = [&]
+                {
+                    auto fn2 = fn;
+
+                    then("the target is copied") = [&]
+                    {
+                        expect(fn() == 0_i);
+                        expect(fn2() == 1_i);
+                        expect(small::live == 2_i);
+                    };
+                };
+            }
+
+            then("every copy is destroyed") = []
+            { expect(small::live == 0_i); };
+        };
+
+        given("a pointer-sized target that changes itself") = []
+        {
+            copyable_function<int()> fn = [n = 0]() mutable { return ++n; };
+            fn();
+
+            when("the wrapper is copied") = [&]
+            {
+                auto fn2 = fn;
+
+                then("each copy keeps its own count") = [&]
+                {
+                    expect(fn() == 2_i);
+                    expect(fn2() == 2_i);
+                    expect(fn2() == 3_i);
+                };
+            };
+        };
+
+        given("a target stored on the heap") = []
+        {
+            {
+                copyable_function<int() const> fn = large{};
+                copyable_function<int() const> fn2;
+
+                when("the wrapper is copy assigned") = [&]
+                {
+                    fn2 = fn;
+
+                    then("the target is copied") = [&]
+                    {
+                        expect(fn2() == 1_i);
+                        expect(large::live == 2_i);
+                    };
+                };
+
+                when("the wrapper is moved") = [&]
+                {
+                    auto fn3 = std::move(fn);
+
+                    then("the target is not copied") = [&]
+                    {
+                        expect(fn3() == 0_i);
+                        expect(fn == nullptr); // extension
+                    };
+                };
+            }
+
+            then("every copy is destroyed") = []
+            { expect(large::live == 0_i); };
+        };
+
+        given("targets that the wrapper does not own") = []
+        {
+            adder a{40};
+            copyable_function<int(int)> unbound = nontype<twice>;
+            copyable_function<int(int)> fp = twice;
+            copyable_function<int(int)> ref = {nontype<&adder::add>,
+                                               std::ref(a)};
+
+            when("they are copied") = [&]
+            {
+                auto unbound2 = unbound;
+                auto fp2 = fp;
+                auto ref2 = ref;
+                a.base = 10;
+
+                then("the copies call the same targets") = [&]
+                {
+                    expect(unbound2(3) == 6_i);
+                    expect(fp2(4) == 8_i);
+                    expect(ref2(1) == 11_i);
+                };
+            };
+        };
+    };
+
+    feature("stateless callable objects") = []
+    {
+        given("a lambda that captures nothing") = []
+        {
+            copyable_function<int(int) const> fn = [](int x) { return -x; };
+            auto fn2 = fn;
+            auto fn3 = std::move(fn);
+
+            then("every wrapper calls it") = [&]
+            {
+                expect(fn2(1) == -1_i);
+                expect(fn3(2) == -2_i);
+            };
+        };
+    };
+
+    feature("empty wrappers") = []
+    {
+        given("a default constructed wrapper") = []
+        {
+            copyable_function<void()> fn;
+            auto fn2 = fn;
+
+            then("copies are empty") = [&]
+            {
+                expect(fn == nullptr);
+                expect(not fn2);
+            };
+        };
+
+        given("a null function pointer") = []
+        {
+            int (*fp)(int) = nullptr;
+            copyable_function<int(int)> fn = fp;
+
+            then("the wrapper is empty") = [&] { expect(fn == nullptr); };
+        };
+    };
+
+    feature("constructing in place") = []
+    {
+        given("a type and its initializers") = []
+        {
+            using str_fn = copyable_function<std::size_t() const>;
+            struct length
+            {
+                std::string s;
+                std::size_t operator()() const { return s.size(); }
+            };
+
+            str_fn fn(std23::in_place_type<length>, "abc");
+            auto fn2 = fn;
+
+            then("the target is built and copied") = [&]
+            {
+                expect(fn() == 3_u);
+                expect(fn2() == 3_u);
+            };
+        };
+    };
+
+    feature("swapping") = []
+    {
+        given("two wrappers") = []
+        {
+            copyable_function<int()> a = [] { return 1; };
+            copyable_function<int()> b = large{};
+
+            swap(a, b);
+
+            then("their targets are exchanged") = [&]
+            {
+                expect(a() == 0_i);
+                expect(b() == 1_i);
+            };
+        };
+    };
+};
+
+static_assert(not std::is_constructible_v<copyable_function<void()>,
+                                          std::unique_ptr<int>>);
+static_assert(not std::is_constructible_v<
+              copyable_function<void()>,
+              decltype([p = std::unique_ptr<int>()] { (void)p; })>);
+static_assert(std::is_nothrow_move_constructible_v<copyable_function<void()>>);
+static_assert(std::is_copy_assignable_v<copyable_function<void()>>);
+
+// Qualifiers of the signature as in move_only_function
+static_assert(std::is_invocable_v<copyable_function<void() const> const &>);
+static_assert(not std::is_invocable_v<copyable_function<void()> const &>);
+static_assert(std::is_invocable_v<copyable_function<void() &&>>);
+static_assert(not std::is_invocable_v<copyable_function<void() &&> &>);
+static_assert(std::is_nothrow_invocable_v<copyable_function<void() noexcept>>);
+static_assert(not std::is_constructible_v<copyable_function<void() noexcept>,
+                                          void (*)()>);
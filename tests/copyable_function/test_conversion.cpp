@@ -0,0 +1,82 @@
+#include "std23/copyable_function.h"
+#include "std23/function_ref.h"
+
+#include <boost/ut.hpp>
+
+#include <array>
+
+using namespace boost::ut;
+
+using std23::copyable_function;
+using std23::function_ref;
+using std23::move_only_function;
+
+template<class T> inline bool is_within(void const *p, T const &obj)
+{
+    auto first = reinterpret_cast<std::byte const *>(std::addressof(obj));
+    auto q = static_cast<std::byte const *>(p);
+    return first <= q and q < first + sizeof(obj);
+}
+
+struct small_where_am_i
+{
+    void *p = nullptr;
+
+    void const *operator()() const noexcept { return this; }
+};
+
+struct large_where_am_i : small_where_am_i
+{
+    std::array<void *, 8> padding{};
+};
+
+suite conversion = []
+{
+    using namespace bdd;
+
+    feature("move_only_function adopts the target") = []
+    {
+        given("a copyable_function holding a small object") = []
+        {
+            copyable_function<void const *() const noexcept> fn =
+                small_where_am_i{};
+
+            when("it is moved into a move_only_function") = [&]
+            {
+                move_only_function<void const *() const> fn2 = std::move(fn);
+
+                then("the target moves into the new wrapper") = [&]
+                {
+                    expect(is_within(fn2(), fn2));
+                    expect(fn == nullptr); // extension
+                };
+            };
+        };
+
+        given("a copyable_function holding a large object") = []
+        {
+            copyable_function<void const *()> fn = large_where_am_i{};
+            auto p = fn();
+
+            when("it is moved into a move_only_function") = [&]
+            {
+                move_only_function<void const *()> fn2 = std::move(fn);
+
+                then("the target stays where it is") = [&]
+                { expect(fn2() == p); };
+            };
+        };
+    };
+
+    feature("function_ref refers to the target") = []
+    {
+        given("a copyable_function") = []
+        {
+            copyable_function<void const *() const> fn = small_where_am_i{};
+            function_ref<void const *() const> ref = fn;
+
+            then("the target is called without the wrapper") = [&]
+            { expect(ref() == fn()); };
+        };
+    };
+};
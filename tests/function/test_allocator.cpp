@@ -0,0 +1,165 @@
+#include "common_callables.h"
+
+#include <array>
+#include <memory_resource>
+#include <vector>
+
+class counting_resource : public std::pmr::memory_resource
+{
+    std::pmr::memory_resource *upstream_ = std::pmr::new_delete_resource();
+
+  public:
+    int allocations = 0;
+    int deallocations = 0;
+
+  private:
+    void *do_allocate(std::size_t bytes, std::size_t align) override
+    {
+        ++allocations;
+        return upstream_->allocate(bytes, align);
+    }
+
+    void do_deallocate(void *p, std::size_t bytes, std::size_t align) override
+    {
+        ++deallocations;
+        upstream_->deallocate(p, bytes, align);
+    }
+
+    bool do_is_equal(memory_resource const &other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+struct large_counter
+{
+    std::array<void *, 8> padding{};
+    int n = 0;
+
+    int operator()() { return n++; }
+};
+
+suite allocator = []
+{
+    using namespace bdd;
+    using std::allocator_arg;
+    using alloc_t = std::pmr::polymorphic_allocator<>;
+
+    feature("boxed targets are allocated by the allocator") = []
+    {
+        given("a memory resource") = []
+        {
+            counting_resource mr;
+
+            when("a large callable object is stored") = [&]
+            {
+                {
+                    function<int()> fn(allocator_arg, alloc_t(&mr),
+                                       large_counter{});
+                    fn();
+
+                    then("it is allocated from the resource") = [&]
+                    {
+                        expect(mr.allocations == 1_i);
+                        expect(fn() == 1_i);
+                    };
+
+                    when("the wrapper is copied") = [&]
+                    {
+                        auto fn2 = fn;
+
+                        then("the copy is allocated from the resource") = [&]
+                        {
+                            expect(mr.allocations == 2_i);
+                            expect(fn2() == 2_i);
+                            expect(fn() == 2_i);
+                        };
+
+                        when("the copy is moved") = [&]
+                        {
+                            auto fn3 = std::move(fn2);
+
+                            then("nothing is reallocated") = [&]
+                            {
+                                expect(mr.allocations == 2_i);
+                                expect(fn3() == 3_i);
+                            };
+                        };
+                    };
+                }
+
+                then("everything is returned to the resource") = [&]
+                { expect(mr.deallocations == 2_i); };
+            };
+        };
+
+        given("a monotonic buffer") = []
+        {
+            std::array<std::byte, 1024> buf;
+            std::pmr::monotonic_buffer_resource mr(
+                buf.data(), buf.size(), std::pmr::null_memory_resource());
+
+            then("copies of a handler table stay in the buffer") = [&]
+            {
+                function<int()> fn(allocator_arg, alloc_t(&mr),
+                                   nontype<&large_counter::operator()>,
+                                   large_counter{});
+
+                std::vector<function<int()>> table(3, fn);
+
+                expect(table[0]() == 0_i);
+                expect(table[2]() == 0_i);
+            };
+        };
+    };
+
+    feature("unboxed targets ignore the allocator") = []
+    {
+        given("a resource that cannot allocate") = []
+        {
+            auto mr = std::pmr::null_memory_resource();
+
+            then("small objects are stored inline") = [&]
+            {
+                function<int()> fn(allocator_arg, alloc_t(mr),
+                                   [] { return 42; });
+                auto fn2 = fn;
+
+                expect(fn2() == 42_i);
+            };
+
+            then("pointers are stored directly") = [&]
+            {
+                function<int()> fn(allocator_arg, alloc_t(mr), f);
+                auto fn2 = fn;
+
+                expect(fn2() == 0_i);
+            };
+
+            then("reference_wrapper is stored directly") = [&]
+            {
+                large_counter obj;
+                function<int()> fn(allocator_arg, alloc_t(mr), std::ref(obj));
+                fn();
+
+                expect(obj.n == 1_i);
+            };
+
+            then("null pointers produce empty wrappers") = [&]
+            {
+                function<int()> fn(allocator_arg, alloc_t(mr),
+                                   static_cast<int (*)()>(nullptr));
+
+                expect(fn == nullptr);
+            };
+        };
+    };
+};
+
+using T = function<int()>;
+
+static_assert(std::is_constructible_v<T, std::allocator_arg_t,
+                                      std::allocator<int>, large_counter>);
+static_assert(
+    std::is_constructible_v<T, std::allocator_arg_t,
+                            std::pmr::polymorphic_allocator<>, large_counter>);
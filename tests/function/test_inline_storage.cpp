@@ -0,0 +1,226 @@
+#include "common_callables.h"
+
+#include <array>
+#include <memory>
+
+template<class T> inline bool is_within(void const *p, T const &obj)
+{
+    auto first = reinterpret_cast<std::byte const *>(std::addressof(obj));
+    auto q = static_cast<std::byte const *>(p);
+    return first <= q and q < first + sizeof(obj);
+}
+
+struct where_am_i
+{
+    void const *operator()() const { return this; }
+};
+
+struct pointer_where_am_i : where_am_i
+{
+    void *p = nullptr;
+};
+
+struct big_where_am_i : where_am_i
+{
+    std::array<void *, 8> padding{};
+};
+
+struct relocatable_where_am_i : where_am_i
+{
+    inline static int copies = 0;
+
+    relocatable_where_am_i() = default;
+    relocatable_where_am_i(relocatable_where_am_i const &) noexcept
+    {
+        ++copies;
+    }
+};
+
+struct copying_where_am_i : where_am_i
+{
+    inline static int copies = 0;
+
+    copying_where_am_i() = default;
+    copying_where_am_i(copying_where_am_i const &) noexcept { ++copies; }
+};
+
+template<>
+struct std23::is_trivially_relocatable<relocatable_where_am_i>
+    : std::true_type
+{};
+
+struct live_counter
+{
+    inline static int live = 0;
+    int n = 0;
+
+    live_counter() { ++live; }
+    live_counter(live_counter const &other) noexcept : n(other.n) { ++live; }
+    ~live_counter() { --live; }
+
+    int operator()() { return n++; }
+};
+
+suite inline_storage = []
+{
+    using namespace bdd;
+
+    feature("small callable objects are stored inside the wrapper") = []
+    {
+        given("a callable object aligned as a pointer") = []
+        {
+            function<void const *()> fn = pointer_where_am_i{};
+
+            then("the target lives in the wrapper") = [&]
+            { expect(is_within(fn(), fn)); };
+
+            when("the wrapper is copied") = [&]
+            {
+                auto fn2 = fn;
+
+                then("the copy lives in the new wrapper") = [&]
+                {
+                    expect(is_within(fn2(), fn2));
+                    expect(is_within(fn(), fn));
+                };
+            };
+
+            when("the wrapper is moved into a new object") = [&]
+            {
+                auto fn2 = std::move(fn);
+
+                then("the target is moved along with the wrapper") = [&]
+                { expect(is_within(fn2(), fn2)); };
+            };
+        };
+
+        given("a nontype-bound object") = []
+        {
+            function<void const *()> fn(nontype<&where_am_i::operator()>,
+                                        where_am_i{});
+
+            then("the object lives in the wrapper") = [&]
+            { expect(is_within(fn(), fn)); };
+        };
+
+        given("a callable object larger than the buffer") = []
+        {
+            function<void const *()> fn = big_where_am_i{};
+
+            then("the target lives elsewhere") = [&]
+            { expect(not is_within(fn(), fn)); };
+        };
+    };
+
+    feature("stateless callable objects are not stored") = []
+    {
+        given("an empty, trivially copyable callable object") = []
+        {
+            function<void const *()> fn = where_am_i{};
+
+            then("one shared object is called each time") = [&]
+            {
+                expect(not is_within(fn(), fn));
+                expect(fn() == fn());
+            };
+
+            when("the wrapper is copied") = [&]
+            {
+                auto fn2 = fn;
+
+                then("both wrappers call the same object") = [&]
+                { expect(fn2() == fn()); };
+            };
+        };
+    };
+
+    feature("trivially relocatable targets are moved bitwise") = []
+    {
+        given("a target that opts into trivial relocation") = []
+        {
+            function<void const *()> fn = relocatable_where_am_i{};
+            auto copies = relocatable_where_am_i::copies;
+
+            then("the target lives in the wrapper") = [&]
+            { expect(is_within(fn(), fn)); };
+
+            when("the wrapper is moved") = [&]
+            {
+                auto fn2 = std::move(fn);
+
+                then("the target is not copied") = [&]
+                {
+                    expect(is_within(fn2(), fn2));
+                    expect(relocatable_where_am_i::copies == copies);
+                };
+            };
+        };
+
+        given("a target that may not be trivially relocatable") = []
+        {
+            function<void const *()> fn = copying_where_am_i{};
+            auto copies = copying_where_am_i::copies;
+
+            then("the target lives in the wrapper") = [&]
+            { expect(is_within(fn(), fn)); };
+
+            when("the wrapper is moved") = [&]
+            {
+                auto fn2 = std::move(fn);
+
+                then("the target is moved by its constructor") = [&]
+                {
+                    expect(is_within(fn2(), fn2));
+                    expect(copying_where_am_i::copies == copies + 1);
+                };
+            };
+
+            when("it is swapped with another wrapper") = []
+            {
+                function<void const *()> fn = copying_where_am_i{};
+                function<void const *()> fn2 = relocatable_where_am_i{};
+                swap(fn, fn2);
+
+                then("each target lives in its new wrapper") = [&]
+                {
+                    expect(is_within(fn(), fn));
+                    expect(is_within(fn2(), fn2));
+                };
+            };
+        };
+    };
+
+    feature("inline targets have value semantics") = []
+    {
+        given("a stateful callable object stored inline") = []
+        {
+            {
+                function<int()> fn = live_counter{};
+                fn();
+                expect(fn() == 1_i);
+                expect(live_counter::live == 1_i);
+
+                when("copying and moving it around") = [&]
+                {
+                    auto fn2 = fn;
+                    auto fn3 = std::move(fn);
+                    swap(fn2, fn3);
+
+                    then("each copy carries its own state") = [&]
+                    {
+                        expect(fn2() == 2_i);
+                        expect(fn3() == 2_i);
+                        expect(fn3() == 3_i);
+                        expect(fn2() == 3_i);
+                    };
+                };
+            }
+
+            then("every object is destroyed") = []
+            { expect(live_counter::live == 0_i); };
+        };
+    };
+};
+
+// A target stored inline may refer to itself
+static_assert(not std23::is_trivially_relocatable_v<function<void()>>);
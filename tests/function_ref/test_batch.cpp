@@ -0,0 +1,157 @@
+#include "common_callables.h"
+
+#include "std23/batch.h"
+
+#include <array>
+#include <span>
+#include <tuple>
+#include <vector>
+
+using std23::batch;
+
+constexpr int square(int x) noexcept
+{
+    return x * x;
+}
+
+struct accumulator
+{
+    int total = 0;
+
+    void add(int x) { total += x; }
+    int scaled(int x, int by) const { return x * by + total; }
+};
+
+suite batch_invocation = []
+{
+    using namespace bdd;
+
+    feature("one call runs a callback over a span") = []
+    {
+        given("an unbound callable") = []
+        {
+            std::vector<int> seen;
+            static std::vector<int> *log;
+            log = &seen;
+
+            function_ref<void(std::span<int const>)> fn =
+                nontype<batch<[](int x) { log->push_back(x); }>>;
+
+            std::array xs{1, 2, 3};
+            fn(xs);
+
+            then("it sees every element in order") = [&]
+            { expect(seen == std::vector{1, 2, 3}); };
+        };
+
+        given("a member function bound to an object") = []
+        {
+            accumulator acc;
+            function_ref<void(std::span<int>)> fn = {
+                nontype<batch<&accumulator::add>>, acc};
+
+            std::array xs{4, 5, 6};
+            fn(xs);
+
+            then("the object is shared by every call") = [&]
+            { expect(acc.total == 15_i); };
+        };
+
+        given("a member function bound to a pointer") = []
+        {
+            accumulator acc;
+            function_ref<void(std::span<int>)> fn = {
+                nontype<batch<&accumulator::add>>, &acc};
+
+            std::array xs{1, 1};
+            fn(xs);
+
+            then("it is called through the pointer") = [&]
+            { expect(acc.total == 2_i); };
+        };
+    };
+
+    feature("results are written to an output span") = []
+    {
+        given("a projection") = []
+        {
+            function_ref<void(std::span<int const>, std::span<int>) noexcept>
+                fn = nontype<batch<square>>;
+
+            std::array xs{1, 2, 3, 4};
+            std::array<int, 4> ys{};
+            fn(xs, ys);
+
+            then("each result lands at the index of its argument") = [&]
+            { expect(ys == std::array{1, 4, 9, 16}); };
+        };
+
+        given("a filter") = []
+        {
+            function_ref<void(std::span<int const>, std::span<bool>)> fn =
+                nontype<batch<[](int x) { return x % 2 == 0; }>>;
+
+            std::array xs{1, 2, 3, 4};
+            std::array<bool, 4> keep{};
+            fn(xs, keep);
+
+            then("the results are converted") = [&]
+            { expect(keep == std::array{false, true, false, true}); };
+        };
+    };
+
+    feature("tuples are spread into arguments") = []
+    {
+        given("a span of argument tuples") = []
+        {
+            accumulator acc{10};
+            function_ref<void(std::span<std::tuple<int, int> const>,
+                              std::span<int>) const>
+                fn = {nontype<batch<&accumulator::scaled>>, acc};
+
+            std::array args{std::tuple(1, 2), std::tuple(3, 4)};
+            std::array<int, 2> out{};
+            fn(args, out);
+
+            then("each tuple makes one call") = [&]
+            { expect(out == std::array{12, 22}); };
+        };
+
+        given("a callable that takes the pair itself") = []
+        {
+            function_ref<void(std::span<std::pair<int, int>>, std::span<int>)>
+                fn = nontype<batch<[](std::pair<int, int> p)
+                                   { return p.first - p.second; }>>;
+
+            std::array args{std::pair(5, 3)};
+            std::array<int, 1> out{};
+            fn(args, out);
+
+            then("the pair is not spread") = [&] { expect(out[0] == 2_i); };
+        };
+    };
+};
+
+using ints = std::span<int>;
+
+static_assert(std::is_nothrow_invocable_v<decltype(batch<square>), ints>);
+static_assert(not std::is_invocable_v<decltype(batch<square>),
+                                      std::span<int *>>);
+static_assert(not std::is_invocable_v<decltype(batch<square>), ints,
+                                      std::span<int *>>);
+static_assert(std::is_invocable_v<decltype(batch<&accumulator::add>),
+                                  accumulator &, ints>);
+static_assert(not std::is_invocable_v<decltype(batch<&accumulator::add>),
+                                      accumulator const &, ints>);
+
+constexpr int sum_of_squares()
+{
+    std::array xs{1, 2, 3};
+    std::array<int, 3> ys{};
+    function_ref<void(std::span<int>, std::span<int>)> fn =
+        nontype<batch<square>>;
+    fn(xs, ys);
+    return ys[0] + ys[1] + ys[2];
+}
+
+static_assert(sum_of_squares() == 14);
@@ -1,5 +1,7 @@
 #include "common_callables.h"
 
+#include <iterator>
+
 struct Base
 {
     int &n;
@@ -26,6 +28,32 @@ static auto f_str()
     return some_str.data();
 };
 
+struct large_pod
+{
+    int v[64];
+};
+
+struct small_pod
+{
+    int v[2];
+};
+
+struct large_by_value
+{
+    int v[64];
+};
+
+template<> struct std23::is_passed_by_value<small_pod> : std::false_type
+{};
+
+template<> struct std23::is_passed_by_value<large_by_value> : std::true_type
+{};
+
+static int ends(auto const &x)
+{
+    return x.v[0] + x.v[std::size(x.v) - 1];
+}
+
 suite call_pattern = []
 {
     using namespace bdd;
@@ -59,6 +87,29 @@ suite call_pattern = []
         } | std::tuple(type<function_ref<void(Track)>>,
                        type<std::function<void(Track)>>);
 
+        given("signatures that take trivially copyable classes") = []
+        {
+            function_ref<int(large_pod)> large = ends<large_pod>;
+            function_ref<int(small_pod)> small = ends<small_pod>;
+            function_ref<int(large_by_value)> opted_in =
+                ends<large_by_value>;
+
+            then("every argument arrives intact") = [=]
+            {
+                large_pod a{};
+                a.v[0] = 1;
+                a.v[63] = 2;
+                small_pod b{{3, 4}};
+                large_by_value c{};
+                c.v[0] = 5;
+                c.v[63] = 6;
+
+                expect(large(a) == 3_i);
+                expect(small(b) == 7_i);
+                expect(opted_in(c) == 11_i);
+            };
+        };
+
         given("a function_ref that has a nontrivial return type") = []
         {
             function_ref<std::string()> fr = f_str;
@@ -75,3 +126,14 @@ suite call_pattern = []
         };
     };
 };
+
+static_assert(std23::is_passed_by_value_v<int>);
+static_assert(std23::is_passed_by_value_v<long double>);
+static_assert(std23::is_passed_by_value_v<int *>);
+#if !defined(_WIN64)
+static_assert(std23::is_passed_by_value_v<std::string_view>);
+#endif
+static_assert(not std23::is_passed_by_value_v<large_pod>);
+static_assert(not std23::is_passed_by_value_v<small_pod>);
+static_assert(not std23::is_passed_by_value_v<Track>);
+static_assert(not std23::is_passed_by_value_v<int &>);
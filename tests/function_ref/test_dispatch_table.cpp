@@ -0,0 +1,102 @@
+#include "common_callables.h"
+
+#include "std23/dispatch_table.h"
+
+#include <utility>
+
+using std23::dispatch_table;
+using std23::make_dispatch_table;
+
+namespace
+{
+
+int plus_one(int x)
+{
+    return x + 1;
+}
+
+constexpr int twice(int x) noexcept
+{
+    return x * 2;
+}
+
+template<int N> constexpr int add(int x) noexcept
+{
+    return x + N;
+}
+
+constinit dispatch_table<int(int), plus_one, twice,
+                         [](long x) { return static_cast<int>(-x); }>
+    handlers;
+
+constinit function_ref<int(int)> second = handlers[1];
+
+template<std::size_t... I>
+constexpr auto make_many(std::index_sequence<I...>)
+{
+    return make_dispatch_table<int(int) noexcept>(nontype<add<int(I)>>...);
+}
+
+constinit auto many = make_many(std::make_index_sequence<32>());
+
+suite dispatch = []
+{
+    using namespace bdd;
+
+    feature("calling the i-th callable") = []
+    {
+        given("a constinit table of three callables") = []
+        {
+            then("the index selects the callable") = []
+            {
+                expect(handlers.size() == 3_u);
+                expect(handlers(0, 5) == 6_i);
+                expect(handlers(1, 5) == 10_i);
+                expect(handlers(2, 5) == -5_i);
+            };
+
+            then("an entry can be taken as a function_ref") = []
+            {
+                expect(second(21) == 42_i);
+                expect(handlers[0](1) == 2_i);
+            };
+        };
+
+        given("a table too large to switch over") = []
+        {
+            then("every callable is reached through the table") = []
+            {
+                for (int i = 0; i != 32; ++i)
+                    expect(many(std::size_t(i), 100) == 100 + i);
+            };
+        };
+    };
+
+    feature("binding members through nontype") = []
+    {
+        given("member functions of one class") = []
+        {
+            A a;
+            auto tbl = make_dispatch_table<int(A &)>(
+                nontype<&A::g>, nontype<&A::k>, nontype<&A::data>);
+
+            then("the object is the first argument") = [&]
+            {
+                expect(tbl(0, a) == ch<'g'>);
+                expect(tbl(1, a) == ch<'k'>);
+                expect(tbl(2, a) == 99_i);
+            };
+        };
+    };
+};
+
+// Usable in constant expressions
+static_assert(make_dispatch_table<int(int)>(nontype<twice>)(0, 4) == 8);
+static_assert(many(31, 1) == 32);
+static_assert(many[3](0) == 3);
+
+static_assert(noexcept(many(0, 0)));
+static_assert(not noexcept(handlers(0, 0)));
+static_assert(std::is_empty_v<decltype(handlers)>);
+
+} // namespace
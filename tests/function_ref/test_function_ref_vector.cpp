@@ -0,0 +1,189 @@
+#include "common_callables.h"
+
+#include "std23/function_ref_vector.h"
+
+#include <string>
+#include <vector>
+
+using std23::function_ref_vector;
+
+struct recorder
+{
+    std::vector<int> *log;
+    int id;
+
+    void operator()(int x) const { log->push_back(id * 100 + x); }
+};
+
+struct other_recorder : recorder
+{};
+
+static std::vector<int> free_log;
+
+static void record(int x)
+{
+    free_log.push_back(x);
+}
+
+suite function_ref_vector_ = []
+{
+    using namespace bdd;
+
+    feature("function_ref_vector invokes every target") = []
+    {
+        given("an empty vector") = []
+        {
+            function_ref_vector<void(int)> v;
+
+            then("it has no target") = [&]
+            {
+                expect(v.empty());
+                expect(v.size() == 0_u);
+                expect(v.group_count() == 0_u);
+            };
+
+            then("invoking it does nothing") = [&] { v.invoke_all(1); };
+        };
+
+        given("targets of interleaved types") = []
+        {
+            std::vector<int> log;
+            recorder a{&log, 1}, c{&log, 3};
+            other_recorder b{{&log, 2}}, d{{&log, 4}};
+
+            function_ref_vector<void(int)> v;
+            v.push_back(a);
+            v.push_back(b);
+            v.push_back(c);
+            v.push_back(d);
+
+            then("targets of the same type share a group") = [&]
+            {
+                expect(v.size() == 4_u);
+                expect(v.group_count() == 2_u);
+            };
+
+            when("invoked") = [&]
+            {
+                v.invoke_all(5);
+
+                then("each group is called in order of appearance") = [&]
+                { expect(log == std::vector{105, 305, 205, 405}); };
+            };
+
+            when("cleared") = [&]
+            {
+                v.clear();
+
+                then("it is empty") = [&]
+                {
+                    expect(v.empty());
+                    expect(v.group_count() == 0_u);
+                };
+            };
+        };
+
+        given("many targets added after reserving room") = []
+        {
+            std::vector<int> log;
+            std::vector<recorder> rs;
+            std::vector<other_recorder> os;
+            for (int i = 0; i != 1000; ++i)
+            {
+                rs.push_back({&log, i});
+                os.push_back({{&log, i}});
+            }
+
+            function_ref_vector<void(int)> v;
+            v.reserve(10);
+            for (std::size_t i = 0; i != rs.size(); ++i)
+            {
+                v.push_back(rs[i]);
+                v.push_back(os[i]);
+            }
+
+            when("invoked") = [&]
+            {
+                v.invoke_all(0);
+
+                then("each group keeps its order of insertion") = [&]
+                {
+                    expect(v.size() == 2000_u);
+                    expect(log.size() == 2000_u);
+                    expect(log[0] == 0_i and log[999] == 99900_i);
+                    expect(log[1000] == 0_i and log[1999] == 99900_i);
+                };
+            };
+        };
+
+        given("free functions and nontype callables") = []
+        {
+            free_log.clear();
+            function_ref_vector<void(int)> v;
+            v.push_back(record);
+            v.push_back(nontype<record>);
+            v.push_back(record);
+
+            then("function pointers share a group") = [&]
+            { expect(v.group_count() == 2_u); };
+
+            when("invoked") = [&]
+            {
+                v.invoke_all(7);
+
+                then("every target is called") = [&]
+                { expect(free_log == std::vector{7, 7, 7}); };
+            };
+        };
+    };
+
+    feature("arguments are shared among the targets") = []
+    {
+        given("targets taking a string by value") = []
+        {
+            std::vector<std::string> seen;
+            auto keep = [&](std::string s) { seen.push_back(std::move(s)); };
+
+            function_ref_vector<void(std::string)> v;
+            v.push_back(keep);
+            v.push_back(keep);
+
+            when("invoked with a string") = [&]
+            {
+                v.invoke_all("a long enough string to be allocated");
+
+                then("every target receives the whole string") = [&]
+                {
+                    expect(seen.size() == 2_u);
+                    expect(seen[0] == seen[1]);
+                    expect(seen[1] == "a long enough string to be allocated");
+                };
+            };
+        };
+
+        given("targets taking a reference") = []
+        {
+            auto inc = [](int &n) { ++n; };
+
+            function_ref_vector<void(int &)> v;
+            v.push_back(inc);
+            v.push_back(inc);
+
+            when("invoked with an lvalue") = [&]
+            {
+                int n = 0;
+                v.invoke_all(n);
+
+                then("every target sees the same object") = [&]
+                { expect(n == 2_i); };
+            };
+        };
+    };
+};
+
+template<class V>
+constexpr bool can_invoke_all = requires(V v) { v.invoke_all(1); };
+
+// A target may move from an rvalue reference argument
+static_assert(can_invoke_all<function_ref_vector<void(int)>>);
+static_assert(not can_invoke_all<function_ref_vector<void(int &&)>>);
@@ -13,6 +13,18 @@ int h_another(A const &)
     return 'h';
 }
 
+struct tally
+{
+    mutable int n = 0;
+};
+
+struct pointer_callable
+{
+    int *p;
+
+    int operator()() const { return *p; }
+};
+
 suite safety = []
 {
     using namespace bdd;
@@ -42,6 +54,46 @@ suite safety = []
                 then("it never dangles") = [&] { expect(fr(a) == ch<'g'>); };
             };
         };
+
+        given("a function_ref to a lambda returning its capture") = []
+        {
+            auto l = [x = 1L]() -> long const & { return x; };
+            function_ref<long const &()> fr = l;
+
+            then("it returns a reference into the lambda") = [&]
+            { expect(&fr() == &l()); };
+        };
+
+        given("a function_ref to a lambda with a mutable capture") = []
+        {
+            auto l = [t = tally{}] { return ++t.n; };
+            function_ref<int()> fr = l;
+            fr();
+            fr();
+            fr();
+
+            then("it refers to the lambda") = [&] { expect(l() == 4_i); };
+        };
+
+        given("a function_ref to a closure that changes when called") = []
+        {
+            auto counter = [n = 0]() mutable { return ++n; };
+            function_ref<int()> fr = counter;
+            fr();
+
+            then("it refers to the closure") = [&]
+            { expect(counter() == 2_i); };
+        };
+
+        given("a function_ref to an object that may be reassigned") = []
+        {
+            int x = 1, y = 2;
+            pointer_callable obj{&x};
+            function_ref<int()> fr = obj;
+            obj.p = &y;
+
+            then("it refers to the object") = [&] { expect(fr() == 2_i); };
+        };
     };
 };
 
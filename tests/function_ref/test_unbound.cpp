@@ -0,0 +1,153 @@
+#include "common_callables.h"
+
+#include "std23/unbound_function_ref.h"
+
+#include <array>
+#include <string>
+
+using std23::unbound_function_ref;
+
+namespace
+{
+
+int times_three(int x) noexcept
+{
+    return x * 3;
+}
+
+std::size_t length(std::string &&s)
+{
+    return s.size();
+}
+
+std::size_t length_of_copy(std::string s)
+{
+    return s.size();
+}
+
+constinit unbound_function_ref<int()> cb_unbound = nontype<f>;
+
+suite unbound = []
+{
+    using namespace bdd;
+
+    feature("referring to a function alone") = []
+    {
+        given("an unbound NTTP callable") = []
+        {
+            unbound_function_ref<int(int)> fn =
+                nontype<[](long x) { return static_cast<int>(x + 1); }>;
+
+            then("it is called with converted arguments") = [&]
+            { expect(fn(41) == 42_i); };
+        };
+
+        given("a function of the exact parameters") = []
+        {
+            unbound_function_ref fn = times_three;
+            unbound_function_ref<std::size_t(std::string)> len = length;
+
+            then("it is called directly") = [&]
+            {
+                expect(fn(4) == 12_i);
+                expect(len("abc") == 3_u);
+            };
+        };
+
+        given("a function taking a class type by value") = []
+        {
+            unbound_function_ref len = nontype<length_of_copy>;
+
+            then("it is bound as an NTTP callable") = [&]
+            { expect(len("abc") == 3_u); };
+        };
+
+        given("a constinit callback") = []
+        {
+            then("it is called") = []
+            { expect(cb_unbound() == free_function); };
+
+            when("rebinding it") = []
+            {
+                cb_unbound = nontype<g<int>>;
+
+                then("its functionality is replaced") = []
+                { expect(cb_unbound() == function_template); };
+            };
+        };
+    };
+
+    feature("converting to function_ref") = []
+    {
+        given("an array of unbound references") = []
+        {
+            std::array<unbound_function_ref<int(int) noexcept>, 2> fns = {
+                times_three, nontype<[](int x) noexcept { return -x; }>};
+
+            when("each is passed on as a function_ref") = [&]
+            {
+                auto call = [](function_ref<int(int) noexcept> fn, int x)
+                { return fn(x); };
+
+                then("the targets are called") = [&]
+                {
+                    expect(call(fns[0], 2) == 6_i);
+                    expect(call(fns[1], 2) == -2_i);
+                };
+            };
+
+            when("it is const or converted directly") = [&]
+            {
+                auto const &first = fns[0];
+                function_ref<int(int) noexcept> a = first;
+                function_ref<int(int)> b(fns[1]);
+
+                then("the targets are called") = [&]
+                {
+                    expect(a(1) == 3_i);
+                    expect(b(1) == -1_i);
+                };
+            };
+
+            when("the unbound reference is gone") = [&]
+            {
+                auto make = [&] { return fns[0]; };
+                function_ref<int(int)> fn = make();
+
+                then("the function_ref refers to the function") = [&]
+                { expect(fn(5) == 15_i); };
+            };
+        };
+    };
+};
+
+// Passed in one register
+static_assert(sizeof(unbound_function_ref<int(int)>) == sizeof(void *));
+static_assert(std::is_trivially_copyable_v<unbound_function_ref<void()>>);
+
+static_assert(noexcept(std::declval<unbound_function_ref<int(int) noexcept>>()(
+    1)));
+static_assert(not std::is_constructible_v<unbound_function_ref<int(int)>,
+                                          long (*)(long)>);
+static_assert(not std::is_constructible_v<unbound_function_ref<int(int)>,
+                                          C &>);
+static_assert(not std::is_constructible_v<function_ref<int(int) noexcept>,
+                                          unbound_function_ref<int(int)>>);
+
+template<auto f>
+constexpr bool can_deduce_from = requires { unbound_function_ref(f); };
+
+// Not a pointer to a function of the parameters that the thunks pass
+static_assert(can_deduce_from<times_three>);
+static_assert(can_deduce_from<length>);
+static_assert(not can_deduce_from<length_of_copy>);
+
+constexpr int forty_two()
+{
+    unbound_function_ref<int()> fn = nontype<[] { return 42; }>;
+    return fn();
+}
+
+static_assert(forty_two() == 42);
+
+} // namespace
@@ -0,0 +1,183 @@
+#include "common_callables.h"
+
+#include "std23/function.h"
+#include "std23/inplace_move_only_function.h"
+#include "std23/move_only_function.h"
+
+using std23::function;
+using std23::move_only_function;
+
+static int first()
+{
+    return 1;
+}
+
+static int second()
+{
+    return 2;
+}
+
+struct counter
+{
+    int n = 0;
+
+    int operator()() { return n++; }
+};
+
+suite unwrap = []
+{
+    using namespace bdd;
+
+    feature("function_ref refers to the target of another wrapper") = []
+    {
+        given("a move_only_function lvalue") = []
+        {
+            move_only_function<int()> fn = counter{};
+            function_ref<int()> fr = fn;
+
+            then("both call the same target") = [&]
+            {
+                expect(fr() == 0_i);
+                expect(fn() == 1_i);
+                expect(fr() == 2_i);
+            };
+        };
+
+        given("a const move_only_function lvalue") = []
+        {
+            move_only_function<int() const noexcept> const fn = []() noexcept
+            { return 3; };
+            function_ref<int() const> fr = fn;
+
+            then("it calls the target") = [&] { expect(fr() == 3_i); };
+        };
+
+        given("an inplace_move_only_function lvalue") = []
+        {
+            std23::inplace_move_only_function<int()> fn = counter{};
+            function_ref<int()> fr = fn;
+            fr();
+
+            then("both call the same target") = [&] { expect(fn() == 1_i); };
+        };
+
+        given("a function lvalue") = []
+        {
+            function<int()> fn = counter{};
+            function_ref<int()> fr = fn;
+
+            then("both call the same target") = [&]
+            {
+                expect(fr() == 0_i);
+                expect(fn() == 1_i);
+                expect(fr() == 2_i);
+            };
+        };
+
+        given("a function bound with nontype") = []
+        {
+            A a;
+            function<int()> fn(nontype<&A::k>, a);
+            function_ref<int()> fr = fn;
+
+            then("it calls the target") = [&] { expect(fr() == 'k'); };
+        };
+
+        given("an empty function") = []
+        {
+            function<int()> fn;
+            function_ref<int()> fr = fn;
+
+            then("calling throws") = [&]
+            { expect(throws<std::bad_function_call>([&] { fr(); })); };
+        };
+
+        when("the wrapper is assigned another target") = []
+        {
+            function<int()> fn = first;
+            function_ref<int()> fr = fn;
+            expect(fr() == 1_i);
+
+            fn = second;
+
+            then("a function_ref bound afterwards calls the new target") =
+                [&]
+            {
+                fr = function_ref<int()>(fn);
+                expect(fr() == 2_i);
+            };
+        };
+    };
+
+    feature("function_ref drops qualifiers without wrapping") = []
+    {
+        given("a noexcept function_ref") = []
+        {
+            counter c;
+            auto inc = [&]() noexcept { return c(); };
+            function_ref<int() noexcept> fr = inc;
+
+            when("it is converted to narrower qualifiers") = [&]
+            {
+                function_ref<int()> a = fr;
+                function_ref<int() const> b = fr;
+
+                then("all call the same target") = [&]
+                {
+                    expect(a() == 0_i);
+                    expect(b() == 1_i);
+                    expect(fr() == 2_i);
+                };
+            };
+        };
+
+        given("a temporary function_ref") = []
+        {
+            counter c;
+            auto inc = [&]() noexcept { return c(); };
+            function_ref<int() noexcept> inner = inc;
+            auto make = [&]
+            { return function_ref<int() const noexcept>(inner); };
+            function_ref<int()> fr = make();
+
+            then("the conversion refers to its target") = [&]
+            {
+                expect(fr() == 0_i);
+                expect(c.n == 1_i);
+            };
+        };
+    };
+};
+
+constexpr int convert_in_constexpr()
+{
+    function_ref<int() const noexcept> fr = nontype<[]() noexcept
+                                                    { return 42; }>;
+    function_ref<int()> converted = fr;
+    return converted();
+}
+
+static_assert(convert_in_constexpr() == 42);
+
+using T = function_ref<int()>;
+
+static_assert(std::is_nothrow_constructible_v<T, move_only_function<int()> &>);
+static_assert(std::is_nothrow_constructible_v<T, function<int()> &>);
+static_assert(
+    std::is_constructible_v<T, move_only_function<int() noexcept> &>);
+static_assert(
+    std::is_constructible_v<T, move_only_function<int() const> const &>);
+static_assert(std::is_constructible_v<T, move_only_function<int(), int()> &>);
+static_assert(std::is_constructible_v<T, move_only_function<long()> &>);
+static_assert(not std::is_constructible_v<T, move_only_function<int() &&> &>);
+static_assert(not std::is_constructible_v<function_ref<int() const>,
+                                          move_only_function<int()> &>);
+static_assert(not std::is_constructible_v<function_ref<int() noexcept>,
+                                          move_only_function<int()> &>);
+
+static_assert(
+    std::is_nothrow_constructible_v<T, function_ref<int() noexcept> &>);
+static_assert(std::is_nothrow_convertible_v<function_ref<int() const noexcept>,
+                                            function_ref<int() const>>);
+static_assert(not std::is_constructible_v<function_ref<int() noexcept>,
+                                          function_ref<int()>>);
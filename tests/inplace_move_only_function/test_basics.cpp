@@ -0,0 +1,102 @@
+#include "common_callables.h"
+
+suite basics = []
+{
+    using namespace bdd;
+
+    "basics"_test = []
+    {
+        given("a default constructed inplace_move_only_function") = []
+        {
+            inplace_move_only_function<int()> fn;
+
+            then("it is empty") = [&]
+            {
+                expect(!fn);
+                expect(fn == nullptr);
+                expect(nullptr == fn);
+            };
+        };
+
+        given("an inplace_move_only_function initialized from function") = []
+        {
+            inplace_move_only_function<int()> fn = f;
+
+            then("it is not empty") = [&]
+            {
+                expect(bool(fn));
+                expect(fn != nullptr);
+                expect(nullptr != fn);
+            };
+
+            when("called") = [&] { expect(fn() == 0_i); };
+        };
+
+        given("an inplace_move_only_function initialized from closure") = []
+        {
+            inplace_move_only_function<int()> fn = [] { return 42; };
+
+            then("it is not empty") = [&]
+            {
+                expect(bool(fn));
+                expect(fn != nullptr);
+                expect(nullptr != fn);
+            };
+
+            when("called") = [&] { expect(fn() == 42_i); };
+        };
+
+        given("a null function pointer") = []
+        {
+            int (*fp)() = nullptr;
+            inplace_move_only_function<int()> fn = fp;
+
+            then("the wrapper is empty") = [&] { expect(fn == nullptr); };
+        };
+    };
+
+    feature("nontype_t constructors") = []
+    {
+        given("an unbound callable") = []
+        {
+            inplace_move_only_function<int()> fn = nontype<f>;
+
+            then("it is callable") = [&] { expect(fn() == free_function); };
+        };
+
+        given("a member function bound to an object") = []
+        {
+            inplace_move_only_function<int()> fn{nontype<&A::g>, A{}};
+
+            then("it is callable") = [&] { expect(fn() == empty); };
+        };
+
+        given("a data member bound to a reference") = []
+        {
+            A a;
+            inplace_move_only_function<int &()> fn{nontype<&A::data>,
+                                                   std::ref(a)};
+
+            then("it refers to the object") = [&]
+            {
+                fn() = 42;
+                expect(a.data == 42_i);
+            };
+        };
+
+        given("a free function bound to an object constructed in-place") = []
+        {
+            inplace_move_only_function<int()> fn{
+                nontype<h>, std23::in_place_type<A>};
+
+            then("it is callable") = [&] { expect(fn() == free_function); };
+        };
+    };
+};
+
+using T = inplace_move_only_function<int()>;
+
+static_assert(std::is_same_v<T::result_type, int>);
+static_assert(std::is_same_v<T, inplace_move_only_function<
+                                    int(), 3 * sizeof(void *),
+                                    alignof(std::max_align_t)>>);
@@ -0,0 +1,96 @@
+#include "common_callables.h"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+template<std::size_t N> struct sized
+{
+    std::array<char, N> data{};
+
+    std::size_t operator()() const { return data.size(); }
+};
+
+struct may_throw_when_moved
+{
+    may_throw_when_moved() = default;
+    may_throw_when_moved(may_throw_when_moved &&) noexcept(false) {}
+
+    int operator()() const { return 0; }
+};
+
+struct alignas(32) overaligned
+{
+    int operator()() const { return 0; }
+};
+
+suite capacity = []
+{
+    using namespace bdd;
+
+    feature("the capacity is specified by the user") = []
+    {
+        given("an object as large as the capacity") = []
+        {
+            inplace_move_only_function<std::size_t(), 64> fn = sized<64>{};
+
+            then("the object is stored") = [&] { expect(fn() == 64_u); };
+
+            when("moving the wrapper") = [&]
+            {
+                auto fn2 = std::move(fn);
+
+                then("the object is relocated") = [&]
+                { expect(fn2() == 64_u); };
+            };
+        };
+
+        given("a capacity that fits a std::vector") = []
+        {
+            inplace_move_only_function<int(), sizeof(std::vector<int>)> fn(
+                nontype<[](std::vector<int> &v) { return int(v.size()); }>,
+                std23::in_place_type<std::vector<int>>, 3u);
+
+            then("the object is constructed in-place") = [&]
+            { expect(fn() == 3_i); };
+        };
+    };
+};
+
+using T = inplace_move_only_function<std::size_t(), 16>;
+
+static_assert(sizeof(T) == 2 * sizeof(void *) + 16 or
+              alignof(T) > alignof(void *));
+static_assert(T::capacity == 16);
+static_assert(T::alignment == alignof(std::max_align_t));
+
+static_assert(std::is_constructible_v<T, sized<16>>);
+static_assert(not std::is_constructible_v<T, sized<17>>,
+              "callable objects larger than the capacity are rejected");
+static_assert(std::is_constructible_v<T, std23::in_place_type_t<sized<16>>>);
+static_assert(
+    not std::is_constructible_v<T, std23::in_place_type_t<sized<17>>>);
+
+inline constexpr auto size_of = [](auto const &x) { return sizeof(x); };
+
+static_assert(std::is_constructible_v<T, nontype_t<size_of>, sized<16>>);
+static_assert(not std::is_constructible_v<T, nontype_t<size_of>, sized<17>>);
+
+using U = inplace_move_only_function<int(), 64>;
+
+static_assert(not std::is_constructible_v<U, may_throw_when_moved>,
+              "stored objects must be nothrow relocatable");
+static_assert(not std::is_constructible_v<U, overaligned>);
+static_assert(std::is_constructible_v<
+              inplace_move_only_function<int(), 32, 32>, overaligned>);
+
+// pointers and references take no space from the buffer
+using V = inplace_move_only_function<std::size_t(), 1, 1>;
+
+static_assert(std::is_nothrow_constructible_v<V, std::size_t (*)()>);
+static_assert(std::is_nothrow_constructible_v<
+              V, std::reference_wrapper<sized<64>>>);
+static_assert(
+    std::is_nothrow_constructible_v<V, nontype_t<&sized<64>::operator()>,
+                                    sized<64> *>);
+static_assert(not std::is_constructible_v<V, sized<64>>);
@@ -0,0 +1,152 @@
+#include "common_callables.h"
+
+#include <array>
+#include <memory_resource>
+#include <string>
+
+class counting_resource : public std::pmr::memory_resource
+{
+    std::pmr::memory_resource *upstream_ = std::pmr::new_delete_resource();
+
+  public:
+    int allocations = 0;
+    int deallocations = 0;
+
+  private:
+    void *do_allocate(std::size_t bytes, std::size_t align) override
+    {
+        ++allocations;
+        return upstream_->allocate(bytes, align);
+    }
+
+    void do_deallocate(void *p, std::size_t bytes, std::size_t align) override
+    {
+        ++deallocations;
+        upstream_->deallocate(p, bytes, align);
+    }
+
+    bool do_is_equal(memory_resource const &other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+struct large_counter
+{
+    std::array<void *, 8> padding{};
+    int n = 0;
+
+    int operator()() { return n++; }
+};
+
+suite allocator = []
+{
+    using namespace bdd;
+    using std::allocator_arg;
+    using alloc_t = std::pmr::polymorphic_allocator<>;
+
+    feature("targets that do not fit are allocated by the allocator") = []
+    {
+        given("a memory resource") = []
+        {
+            counting_resource mr;
+
+            when("a large callable object is stored") = [&]
+            {
+                {
+                    move_only_function<int()> fn(allocator_arg, alloc_t(&mr),
+                                                 large_counter{});
+                    fn();
+
+                    then("it is allocated from the resource") = [&]
+                    {
+                        expect(mr.allocations == 1_i);
+                        expect(fn() == 1_i);
+                    };
+
+                    when("the wrapper is moved") = [&]
+                    {
+                        auto fn2 = std::move(fn);
+
+                        then("nothing is reallocated") = [&]
+                        {
+                            expect(mr.allocations == 1_i);
+                            expect(fn2() == 2_i);
+                        };
+                    };
+                }
+
+                then("it is returned to the resource") = [&]
+                { expect(mr.deallocations == 1_i); };
+            };
+        };
+
+        given("a monotonic buffer") = []
+        {
+            std::array<std::byte, 1024> buf;
+            std::pmr::monotonic_buffer_resource mr(
+                buf.data(), buf.size(), std::pmr::null_memory_resource());
+
+            then("in-place construction allocates from the buffer") = [&]
+            {
+                move_only_function<std::size_t()> fn(
+                    allocator_arg, alloc_t(&mr),
+                    nontype<&std::string::size>,
+                    std::in_place_type<std::string>, 200u, 'x');
+
+                expect(fn() == 200_u);
+            };
+
+            then("a bound object is allocated from the buffer") = [&]
+            {
+                move_only_function<int()> fn(
+                    allocator_arg, alloc_t(&mr),
+                    nontype<&large_counter::operator()>, large_counter{});
+
+                expect(fn() == 0_i);
+            };
+        };
+    };
+
+    feature("targets that do not need memory ignore the allocator") = []
+    {
+        given("a resource that cannot allocate") = []
+        {
+            auto mr = std::pmr::null_memory_resource();
+
+            then("small objects are stored inline") = [&]
+            {
+                move_only_function<int()> fn(allocator_arg, alloc_t(mr),
+                                             [] { return 42; });
+
+                expect(fn() == 42_i);
+            };
+
+            then("pointers are stored directly") = [&]
+            {
+                move_only_function<int()> fn(allocator_arg, alloc_t(mr), f);
+
+                expect(fn() == free_function);
+            };
+
+            then("null pointers produce empty wrappers") = [&]
+            {
+                move_only_function<int()> fn(allocator_arg, alloc_t(mr),
+                                             static_cast<int (*)()>(nullptr));
+
+                expect(fn == nullptr);
+            };
+        };
+    };
+};
+
+using T = move_only_function<int()>;
+
+static_assert(std::is_constructible_v<T, std::allocator_arg_t,
+                                      std::allocator<int>, large_counter>);
+static_assert(
+    std::is_constructible_v<T, std::allocator_arg_t,
+                            std::pmr::polymorphic_allocator<>, large_counter>);
+static_assert(not std::is_constructible_v<T, std::allocator_arg_t,
+                                          std::allocator<int>, std::string>,
+              "target must be callable");
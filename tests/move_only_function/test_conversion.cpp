@@ -0,0 +1,219 @@
+#include "common_callables.h"
+
+#include "std23/function.h"
+
+#include <array>
+
+template<class T> inline bool is_within(void const *p, T const &obj)
+{
+    auto first = reinterpret_cast<std::byte const *>(std::addressof(obj));
+    auto q = static_cast<std::byte const *>(p);
+    return first <= q and q < first + sizeof(obj);
+}
+
+struct small_where_am_i
+{
+    void *p = nullptr;
+
+    void const *operator()() const noexcept { return this; }
+};
+
+struct large_where_am_i : small_where_am_i
+{
+    std::array<void *, 8> padding{};
+};
+
+struct counted
+{
+    inline static int live = 0;
+    std::array<void *, 4> padding{};
+
+    counted() { ++live; }
+    counted(counted const &) { ++live; }
+    ~counted() { --live; }
+
+    int operator()() const { return live; }
+};
+
+using std23::function;
+
+suite conversion = []
+{
+    using namespace bdd;
+
+    feature("move_only_function adopts the target of another "
+            "move_only_function") = []
+    {
+        given("a noexcept wrapper holding a small object") = []
+        {
+            move_only_function<void const *() const noexcept> fn =
+                small_where_am_i{};
+
+            when("it is converted to drop noexcept") = [&]
+            {
+                move_only_function<void const *() const> fn2 = std::move(fn);
+
+                then("the target moves into the new wrapper") = [&]
+                {
+                    expect(is_within(fn2(), fn2));
+                    expect(fn == nullptr); // extension
+                };
+            };
+        };
+
+        given("a wrapper holding a large object") = []
+        {
+            move_only_function<void const *() const> fn = large_where_am_i{};
+            auto p = fn();
+
+            when("it is converted to drop const") = [&]
+            {
+                move_only_function<void const *()> fn2 = std::move(fn);
+
+                then("the target is not moved") = [&]
+                {
+                    expect(fn2() == p);
+                    expect(fn == nullptr); // extension
+                };
+            };
+        };
+
+        given("an empty wrapper") = []
+        {
+            move_only_function<int() noexcept> fn;
+
+            when("it is converted") = [&]
+            {
+                move_only_function<int()> fn2 = std::move(fn);
+
+                then("the new wrapper is empty") = [&]
+                { expect(fn2 == nullptr); };
+            };
+        };
+
+        given("a wrapper of an incompatible return type") = []
+        {
+            move_only_function<int()> fn = [] { return 3; };
+
+            when("it is converted") = [&]
+            {
+                move_only_function<long()> fn2 = std::move(fn);
+
+                then("the new wrapper wraps the old one") = [&]
+                { expect(fn2() == 3_l); };
+            };
+        };
+    };
+
+    feature("move_only_function adopts the target of function") = []
+    {
+        given("a function holding a small object") = []
+        {
+            function<void const *()> fn = small_where_am_i{};
+
+            when("it is converted") = [&]
+            {
+                move_only_function<void const *() const> fn2 = std::move(fn);
+
+                then("the target moves into move_only_function") = [&]
+                {
+                    expect(is_within(fn2(), fn2));
+                    expect(fn == nullptr);
+                };
+
+                then("the target is relocated along with the wrapper") = [&]
+                {
+                    auto fn3 = std::move(fn2);
+                    expect(is_within(fn3(), fn3));
+                };
+            };
+        };
+
+        given("a function holding a large object") = []
+        {
+            function<void const *()> fn = large_where_am_i{};
+            auto p = fn();
+
+            when("it is converted") = [&]
+            {
+                move_only_function<void const *() &&> fn2 = std::move(fn);
+
+                then("the target is not moved") = [&]
+                {
+                    expect(std::move(fn2)() == p);
+                    expect(fn == nullptr);
+                };
+            };
+        };
+
+        given("a function bound to an object with nontype") = []
+        {
+            struct A
+            {
+                int n;
+                int get() const { return n; }
+            };
+
+            A obj{7};
+            function<int()> fn(nontype<&A::get>, obj);
+            function<int()> fn_ref(nontype<&A::get>, &obj);
+
+            when("they are converted") = [&]
+            {
+                move_only_function<int()> fn2 = std::move(fn);
+                move_only_function<int()> fn2_ref = std::move(fn_ref);
+                obj.n = 8;
+
+                then("each calls through its own binding") = [&]
+                {
+                    expect(fn2() == 7_i);
+                    expect(fn2_ref() == 8_i);
+                };
+            };
+        };
+
+        given("a function holding a nontype callable") = []
+        {
+            function<int()> fn = nontype<f>;
+
+            when("it is converted") = [&]
+            {
+                move_only_function<int()> fn2 = std::move(fn);
+
+                then("it calls the same function") = [&]
+                { expect(fn2() == free_function); };
+            };
+        };
+
+        given("an empty function") = []
+        {
+            function<int()> fn;
+
+            when("it is converted") = [&]
+            {
+                move_only_function<int()> fn2 = std::move(fn);
+
+                then("the new wrapper is empty") = [&]
+                { expect(fn2 == nullptr); };
+            };
+        };
+
+        given("a function with an allocated target") = []
+        {
+            {
+                function<int()> fn(std::allocator_arg,
+                                   std::allocator<counted>(), counted{});
+                move_only_function<int()> fn2 = std::move(fn);
+
+                then("the target is taken over") = [&]
+                {
+                    expect(fn2() == 1_i);
+                    expect(counted::live == 1_i);
+                };
+            }
+
+            then("the target is destroyed by its new owner") = []
+            { expect(counted::live == 0_i); };
+        };
+    };
+};
@@ -0,0 +1,284 @@
+#include "common_callables.h"
+
+#include <array>
+#include <memory>
+
+template<class T> inline bool is_within(void const *p, T const &obj)
+{
+    auto first = reinterpret_cast<std::byte const *>(std::addressof(obj));
+    auto q = static_cast<std::byte const *>(p);
+    return first <= q and q < first + sizeof(obj);
+}
+
+struct where_am_i
+{
+    void const *operator()() const { return this; }
+};
+
+struct pointer_where_am_i : where_am_i
+{
+    void *p = nullptr;
+};
+
+struct mutable_counter
+{
+    mutable int n = 0;
+
+    int operator()() const { return ++n; }
+};
+
+struct big_where_am_i : where_am_i
+{
+    std::array<void *, 8> padding{};
+};
+
+struct throwing_where_am_i : where_am_i
+{
+    throwing_where_am_i() = default;
+    throwing_where_am_i(throwing_where_am_i &&) noexcept(false) {}
+};
+
+struct relocatable_where_am_i : where_am_i
+{
+    inline static int moves = 0;
+
+    relocatable_where_am_i() = default;
+    relocatable_where_am_i(relocatable_where_am_i &&) noexcept { ++moves; }
+};
+
+template<>
+struct std23::is_trivially_relocatable<relocatable_where_am_i>
+    : std::true_type
+{};
+
+struct live_counter
+{
+    inline static int live = 0;
+    std::unique_ptr<int> n_ = std::make_unique<int>(0);
+
+    live_counter() { ++live; }
+    live_counter(live_counter &&other) noexcept : n_(std::move(other.n_))
+    {
+        ++live;
+    }
+    ~live_counter() { --live; }
+
+    int operator()() { return (*n_)++; }
+};
+
+suite inline_storage = []
+{
+    using namespace bdd;
+
+    feature("small callable objects are stored inside the wrapper") = []
+    {
+        given("a callable object aligned as a pointer") = []
+        {
+            move_only_function<void const *() const> fn = pointer_where_am_i{};
+
+            then("the target lives in the wrapper") = [&]
+            { expect(is_within(fn(), fn)); };
+
+            when("the wrapper is moved into a new object") = [&]
+            {
+                auto fn2 = std::move(fn);
+
+                then("the target is relocated along with the wrapper") = [&]
+                {
+                    expect(is_within(fn2(), fn2));
+                    expect(fn == nullptr); // extension
+                };
+            };
+        };
+
+        given("a nontype-bound object") = []
+        {
+            move_only_function<void const *() const> fn(
+                nontype<&where_am_i::operator()>, where_am_i{});
+
+            then("the object lives in the wrapper") = [&]
+            { expect(is_within(fn(), fn)); };
+        };
+
+        given("an in-place constructed callable object") = []
+        {
+            move_only_function<void const *() const> fn(
+                std23::in_place_type<where_am_i>);
+
+            then("the target lives in the wrapper") = [&]
+            { expect(is_within(fn(), fn)); };
+        };
+
+        given("a lambda capturing a pointer") = []
+        {
+            int n = 0;
+            move_only_function<void const *() const> fn = [p = &n]
+            { return static_cast<void const *>(&p); };
+
+            then("its capture lives in the wrapper") = [&]
+            { expect(is_within(fn(), fn)); };
+        };
+    };
+
+    feature("stateless callable objects are not stored") = []
+    {
+        given("an empty, trivially copyable callable object") = []
+        {
+            move_only_function<void const *() const> fn = where_am_i{};
+
+            then("one shared object is called each time") = [&]
+            {
+                expect(not is_within(fn(), fn));
+                expect(fn() == fn());
+            };
+
+            when("the wrapper is moved into a new object") = [&]
+            {
+                auto p = fn();
+                auto fn2 = std::move(fn);
+
+                then("the same object is still called") = [&]
+                {
+                    expect(fn2() == p);
+                    expect(fn == nullptr); // extension
+                };
+            };
+        };
+    };
+
+    feature("pointer-sized callable objects keep their state") = []
+    {
+        given("an object that changes its mutable member") = []
+        {
+            move_only_function<int()> fn = mutable_counter{};
+            move_only_function<int() const> cfn = mutable_counter{};
+
+            then("every call reaches the same object") = [&]
+            {
+                expect(fn() == 1_i);
+                expect(fn() == 2_i);
+                expect(cfn() == 1_i);
+                expect(cfn() == 2_i);
+            };
+
+            when("the wrapper is moved") = [&]
+            {
+                auto fn2 = std::move(fn);
+
+                then("the count is moved along") = [&]
+                { expect(fn2() == 3_i); };
+            };
+        };
+
+        given("a lambda returning a reference to its capture") = []
+        {
+            move_only_function<long const &()> fn = [x = 1L]() -> long const &
+            { return x; };
+
+            then("the reference refers into the wrapper") = [&]
+            {
+                expect(fn() == 1_l);
+                expect(is_within(&fn(), fn));
+            };
+        };
+
+        given("a lambda writing through a captured pointer") = []
+        {
+            int n = 0;
+            move_only_function<int()> fn = [p = &n] { return ++*p; };
+
+            when("the wrapper is moved") = [&]
+            {
+                auto fn2 = std::move(fn);
+
+                then("the pointer is moved along") = [&]
+                {
+                    expect(fn2() == 1_i);
+                    expect(fn2() == 2_i);
+                };
+            };
+        };
+
+        given("a mutable lambda") = []
+        {
+            move_only_function<int()> fn = [n = 0]() mutable { return ++n; };
+
+            then("its state lives in the wrapper") = [&]
+            {
+                expect(fn() == 1_i);
+                expect(fn() == 2_i);
+            };
+        };
+    };
+
+    feature("other callable objects are allocated") = []
+    {
+        given("a callable object larger than the buffer") = []
+        {
+            move_only_function<void const *() const> fn = big_where_am_i{};
+
+            then("the target lives elsewhere") = [&]
+            { expect(not is_within(fn(), fn)); };
+        };
+
+        given("a callable object that may throw when moved") = []
+        {
+            move_only_function<void const *() const> fn =
+                throwing_where_am_i{};
+
+            then("the target lives elsewhere") = [&]
+            { expect(not is_within(fn(), fn)); };
+        };
+    };
+
+    feature("relocation preserves lifetime") = []
+    {
+        given("a stateful callable object stored inline") = []
+        {
+            {
+                move_only_function<int()> fn = live_counter{};
+                fn();
+                expect(fn() == 1_i);
+                expect(live_counter::live == 1_i);
+
+                when("moving it around") = [&]
+                {
+                    auto fn2 = std::move(fn);
+                    fn = std::move(fn2);
+                    swap(fn, fn2);
+
+                    then("the state moves with it") = [&]
+                    {
+                        expect(fn2() == 2_i);
+                        expect(live_counter::live == 1_i);
+                    };
+                };
+            }
+
+            then("every object is destroyed") = []
+            { expect(live_counter::live == 0_i); };
+        };
+
+        given("a target that opts into trivial relocation") = []
+        {
+            move_only_function<void const *() const> fn =
+                relocatable_where_am_i{};
+            auto moves = relocatable_where_am_i::moves;
+
+            when("the wrapper is moved") = [&]
+            {
+                auto fn2 = std::move(fn);
+
+                then("the target is copied bitwise") = [&]
+                {
+                    expect(is_within(fn2(), fn2));
+                    expect(relocatable_where_am_i::moves == moves);
+                };
+            };
+        };
+    };
+};
+
+// Inline targets refer to the wrapper
+static_assert(
+    not std23::is_trivially_relocatable_v<move_only_function<void()>>);
@@ -0,0 +1,297 @@
+#include "std23/signal.h"
+
+#include <boost/ut.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace boost::ut;
+
+using std23::connection;
+
+struct tracked
+{
+    inline static int live = 0;
+
+    std::vector<int> *log;
+    int id;
+
+    tracked(std::vector<int> &l, int n) : log(&l), id(n) { ++live; }
+    tracked(tracked &&other) noexcept : log(other.log), id(other.id)
+    {
+        ++live;
+    }
+    ~tracked() { --live; }
+
+    void operator()(int x) const { log->push_back(id * 100 + x); }
+};
+
+suite basics = []
+{
+    using namespace bdd;
+
+    feature("emitting a signal calls the connected slots") = []
+    {
+        given("a signal with three slots") = []
+        {
+            std::vector<int> log;
+            std23::signal<void(int)> sig;
+            auto a = sig.connect(tracked(log, 1));
+            auto b = sig.connect(tracked(log, 2));
+            auto c = sig.connect(tracked(log, 3));
+
+            then("every connection is distinct") = [&]
+            {
+                expect(sig.size() == 3_u);
+                expect(a != b and b != c);
+                expect(sig.connected(a) and sig.connected(c));
+            };
+
+            when("emitted") = [&]
+            {
+                sig.emit(5);
+
+                then("the slots are called in order") = [&]
+                { expect(log == std::vector{105, 205, 305}); };
+            };
+
+            when("a slot is disconnected") = [&]
+            {
+                log.clear();
+                expect(sig.disconnect(b));
+                sig.emit(6);
+
+                then("it is no longer called") = [&]
+                {
+                    expect(log == std::vector{106, 306});
+                    expect(not sig.connected(b));
+                    expect(not sig.disconnect(b));
+                    expect(sig.size() == 2_u);
+                };
+            };
+
+            when("its slot is reused") = [&]
+            {
+                log.clear();
+                auto d = sig.connect(tracked(log, 4));
+                sig.emit(7);
+
+                then("the old connection stays disconnected") = [&]
+                {
+                    expect(not sig.connected(b));
+                    expect(not sig.disconnect(b));
+                    expect(sig.connected(d));
+                    expect(log == std::vector{107, 407, 307});
+                };
+            };
+
+            when("everything is disconnected") = [&]
+            {
+                sig.disconnect_all();
+
+                then("the signal is empty") = [&]
+                {
+                    expect(sig.empty());
+                    expect(tracked::live == 0_i);
+                };
+            };
+        };
+
+        given("an empty target") = []
+        {
+            std23::signal<void(int)> sig;
+            auto c = sig.connect(static_cast<void (*)(int)>(nullptr));
+
+            then("nothing is connected") = [&]
+            {
+                expect(sig.empty());
+                expect(c == connection());
+                expect(not sig.connected(c));
+            };
+        };
+
+        given("slots taking a string by value") = []
+        {
+            std::vector<std::string> seen;
+            std23::signal<void(std::string)> sig;
+            auto keep = [&](std::string s) { seen.push_back(std::move(s)); };
+            sig.connect(keep);
+            sig.connect(keep);
+
+            when("emitted") = [&]
+            {
+                sig.emit("a long enough string to be allocated");
+
+                then("every slot receives the whole string") = [&]
+                {
+                    expect(seen.size() == 2_u);
+                    expect(seen[0] == seen[1]);
+                };
+            };
+        };
+    };
+
+    feature("slots may change the signal while it is emitted") = []
+    {
+        given("a slot that disconnects itself") = []
+        {
+            std::vector<int> log;
+            std23::signal<void(int)> sig;
+            connection self;
+            self = sig.connect(
+                [&, state = std::make_unique<int>(1)](int x)
+                {
+                    sig.disconnect(self);
+                    log.push_back(*state + x); // still alive
+                });
+            sig.connect(tracked(log, 2));
+
+            when("emitted twice") = [&]
+            {
+                sig.emit(1);
+                sig.emit(2);
+
+                then("it is called once") = [&]
+                { expect(log == std::vector{2, 201, 202}); };
+            };
+        };
+
+        given("a slot that disconnects a later one") = []
+        {
+            std::vector<int> log;
+            std23::signal<void(int)> sig;
+            connection later;
+            sig.connect([&](int) { sig.disconnect(later); });
+            later = sig.connect(tracked(log, 2));
+
+            when("emitted") = [&]
+            {
+                sig.emit(1);
+
+                then("the later slot is not called") = [&]
+                {
+                    expect(log.empty());
+                    expect(sig.size() == 1_u);
+                };
+            };
+        };
+
+        given("a slot that connects another") = []
+        {
+            std::vector<int> log;
+            std23::signal<void(int)> sig;
+            auto first = sig.connect(tracked(log, 1));
+            sig.disconnect(first); // leaves a free slot
+            sig.connect(
+                [&](int)
+                {
+                    if (sig.size() == 1)
+                        sig.connect(tracked(log, 3));
+                });
+
+            when("emitted") = [&]
+            {
+                sig.emit(1);
+
+                then("the new slot waits for the next emission") = [&]
+                {
+                    expect(log.empty());
+                    sig.emit(2);
+                    expect(log == std::vector{302});
+                };
+            };
+        };
+
+        given("a slot that emits the signal again") = []
+        {
+            std::vector<int> log;
+            std23::signal<void(int)> sig;
+            connection self;
+            self = sig.connect(
+                [&](int x)
+                {
+                    sig.disconnect(self);
+                    if (x == 1)
+                        sig.emit(2);
+                });
+            sig.connect(tracked(log, 2));
+
+            when("emitted") = [&]
+            {
+                sig.emit(1);
+
+                then("the slots are destroyed after the outer emission") =
+                    [&] { expect(log == std::vector{202, 201}); };
+            };
+        };
+
+        given("a slot that throws") = []
+        {
+            std::vector<int> log;
+            std23::signal<void(int)> sig;
+            connection self;
+            self = sig.connect(
+                [&](int)
+                {
+                    sig.disconnect(self);
+                    throw 42;
+                });
+            sig.connect(tracked(log, 2));
+
+            when("emitted") = [&]
+            {
+                expect(throws<int>([&] { sig.emit(1); }));
+
+                then("the signal remains usable") = [&]
+                {
+                    sig.emit(2);
+                    expect(log == std::vector{202});
+                    expect(sig.size() == 1_u);
+                };
+            };
+        };
+    };
+
+    feature("slots are called with the qualifiers in the signature") = []
+    {
+        struct qualified
+        {
+            std::vector<int> *log;
+
+            void operator()() & { log->push_back(1); }
+            void operator()() const & { log->push_back(2); }
+        };
+
+        given("signals of each signature") = []
+        {
+            std::vector<int> log;
+            std23::signal<void()> sig;
+            std23::signal<void() const> const_sig;
+            std23::signal<void() const noexcept> noexcept_sig;
+
+            sig.connect(qualified{&log});
+            const_sig.connect(qualified{&log});
+            noexcept_sig.connect([]() noexcept {});
+
+            static_assert(noexcept(noexcept_sig.emit()));
+            static_assert(not noexcept(const_sig.emit()));
+
+            when("emitted") = [&]
+            {
+                sig.emit();
+                const_sig.emit();
+
+                then("each slot is called accordingly") = [&]
+                { expect(log == std::vector{1, 2}); };
+            };
+        };
+    };
+};
+
+template<class V>
+constexpr bool can_emit = requires(V v) { v.emit(1); };
+
+// A slot may move from an rvalue reference argument
+static_assert(can_emit<std23::signal<void(int)>>);
+static_assert(not can_emit<std23::signal<void(int &&)>>);
@@ -0,0 +1,2 @@
+int main()
+{}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include "std23/task_queue.h"
+
+#include <boost/ut.hpp>
+
+#include <array>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace boost::ut;
+
+using std23::move_only_function;
+using std23::task_queue;
+
+suite basics = []
+{
+    using namespace bdd;
+
+    feature("tasks come out in the order they went in") = []
+    {
+        given("a queue of capacity 3") = []
+        {
+            task_queue q(3);
+            std::vector<int> log;
+
+            then("the capacity is rounded up") = [&]
+            { expect(q.capacity() == 4_u); };
+
+            when("it is filled") = [&]
+            {
+                for (int i = 0; i != 4; ++i)
+                    expect(q.try_push([&, i] { log.push_back(i); }));
+
+                then("pushing more fails and keeps the task") = [&]
+                {
+                    move_only_function<void() &&> fn = [&]
+                    { log.push_back(9); };
+                    expect(not q.try_push(std::move(fn)));
+                    expect(fn != nullptr);
+                };
+
+                then("the tasks are popped in order") = [&]
+                {
+                    move_only_function<void() &&> fn;
+                    while (q.try_pop(fn))
+                        std::move(fn)();
+
+                    expect(log == std::vector{0, 1, 2, 3});
+                };
+            };
+        };
+
+        given("a queue that wraps around") = []
+        {
+            task_queue<int() &&> q(2);
+            std::array<move_only_function<int() &&>, 3> out;
+            int sum = 0;
+
+            for (int round = 0; round != 5; ++round)
+            {
+                q.push([round] { return round * 10; });
+                q.push([round, p = std::make_unique<int>(1)]
+                       { return round * 10 + *p; });
+
+                auto n = q.try_pop(out);
+                expect(n == 2_u);
+                for (std::size_t i = 0; i != n; ++i)
+                    sum += std::move(out[i])();
+            }
+
+            then("every task is run once") = [&]
+            {
+                expect(sum == 205_i);
+                expect(q.try_pop(out) == 0_u);
+            };
+        };
+    };
+
+    feature("many threads may push at once") = []
+    {
+        given("four producers") = []
+        {
+            constexpr int producers = 4;
+            constexpr int tasks = 10000;
+
+            task_queue q(64);
+            std::array<int, producers> ran{};
+            std::vector<std::thread> threads;
+            for (int p = 0; p != producers; ++p)
+            {
+                threads.emplace_back(
+                    [&, p]
+                    {
+                        for (int i = 0; i != tasks; ++i)
+                            q.push([&ran, p, i]
+                                   { expect(ran[std::size_t(p)]++ == i); });
+                    });
+            }
+
+            when("one consumer drains the queue") = [&]
+            {
+                std::array<move_only_function<void() &&>, 16> batch;
+                for (int done = 0; done != producers * tasks;)
+                {
+                    auto n = q.try_pop(batch);
+                    for (std::size_t i = 0; i != n; ++i)
+                        std::move(batch[i])();
+
+                    done += static_cast<int>(n);
+                    if (n == 0)
+                        std::this_thread::yield();
+                }
+
+                for (auto &t : threads)
+                    t.join();
+
+                then("each producer's tasks run in order") = [&]
+                {
+                    for (auto n : ran)
+                        expect(n == tasks);
+                };
+            };
+        };
+    };
+};
@@ -0,0 +1,119 @@
+#include "std23/thread_pool.h"
+
+#include <boost/ut.hpp>
+
+#include <atomic>
+#include <latch>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace boost::ut;
+
+using std23::thread_pool;
+
+// Submits two children until depth reaches zero
+static void spawn(thread_pool &pool, std::atomic<int> &nodes, int depth)
+{
+    ++nodes;
+    if (depth == 0)
+        return;
+
+    for (int i = 0; i != 2; ++i)
+        pool.submit([&pool, &nodes, depth]
+                    { spawn(pool, nodes, depth - 1); });
+}
+
+suite basics = []
+{
+    using namespace bdd;
+
+    feature("every submitted task runs once") = []
+    {
+        given("a pool of three workers") = []
+        {
+            constexpr int tasks = 10000;
+            std::vector<std::atomic<int>> ran(tasks);
+
+            {
+                thread_pool pool(3);
+                expect(pool.size() == 3_u);
+
+                for (int i = 0; i != tasks; ++i)
+                    pool.submit([&ran, i] { ++ran[std::size_t(i)]; });
+            }
+
+            then("the destructor waits for them") = [&]
+            {
+                for (auto &n : ran)
+                    expect(n.load() == 1_i);
+            };
+        };
+
+        given("tasks that own their state") = []
+        {
+            std::atomic<int> sum = 0;
+
+            {
+                thread_pool pool(2);
+                for (int i = 0; i != 100; ++i)
+                    pool.submit([&sum, p = std::make_unique<int>(i)]
+                                { sum += *p; });
+            }
+
+            then("the state moves along with them") = [&]
+            { expect(sum.load() == 4950_i); };
+        };
+
+        given("a pool asked for no workers") = []
+        {
+            std::atomic<int> ran = 0;
+
+            {
+                thread_pool pool(0);
+                expect(pool.size() == 1_u);
+                pool.submit([&ran] { ++ran; });
+            }
+
+            then("it runs them on one worker") = [&]
+            { expect(ran.load() == 1_i); };
+        };
+
+        given("tasks that submit more tasks") = []
+        {
+            std::atomic<int> nodes = 0;
+
+            {
+                thread_pool pool(4);
+                pool.submit([&] { spawn(pool, nodes, 12); });
+            }
+
+            then("the destructor waits for those as well") = [&]
+            { expect(nodes.load() == 8191_i); };
+        };
+    };
+
+    feature("idle workers steal tasks") = []
+    {
+        given("a task that waits for the tasks it submits") = []
+        {
+            std::atomic<bool> done = false;
+
+            {
+                thread_pool pool(4);
+                pool.submit(
+                    [&]
+                    {
+                        std::latch children(3);
+                        for (int i = 0; i != 3; ++i)
+                            pool.submit([&] { children.count_down(); });
+
+                        children.wait(); // blocks this worker
+                        done = true;
+                    });
+            }
+
+            then("the other workers run them") = [&] { expect(done.load()); };
+        };
+    };
+};